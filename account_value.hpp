@@ -44,6 +44,7 @@ class Input;
 class Ledger;
 class LedgerInvariant;
 class LedgerVariant;
+class projection_checkpoint;
 
 class LMI_SO AccountValue final
     :protected BasicValues
@@ -56,13 +57,22 @@ class LMI_SO AccountValue final
     enum {months_per_year = 12};
 
     explicit AccountValue(Input const& input);
+    explicit AccountValue(yare_input const& consummated_input);
     AccountValue(AccountValue&&) = default;
     ~AccountValue() override = default;
 
     double RunAV                ();
+    double ResumeAV             (projection_checkpoint const&);
 
     void SetDebugFilename    (std::string const&);
 
+    void set_checkpoint_interval(int);
+    std::vector<std::shared_ptr<projection_checkpoint const>> checkpoints() const;
+
+    void set_concurrent_bases(bool);
+
+    void set_secant_solves(bool);
+
     void SolveSetPmts // Antediluvian.
         (double a_Pmt
         ,int    ThatSolveBegYear
@@ -92,9 +102,12 @@ class LMI_SO AccountValue final
     std::shared_ptr<Ledger const> ledger_from_av() const;
 
   private:
-    AccountValue(AccountValue const&) = delete;
+    AccountValue(AccountValue const&) = default;
     AccountValue& operator=(AccountValue const&) = delete;
 
+    std::shared_ptr<AccountValue> clone() const;
+    void TakeCheckpoint();
+
     LedgerInvariant const& InvariantValues() const;
     LedgerVariant   const& VariantValues  () const;
 
@@ -131,8 +144,11 @@ class LMI_SO AccountValue final
     LedgerVariant  & VariantValues  ();
 
     double RunOneCell              (mcenum_run_basis);
+    double ContinueOneCell         (mcenum_run_basis, int first_year);
     double RunOneBasis             (mcenum_run_basis);
     double RunAllApplicableBases   ();
+    void   RunBasesAfterCurrent    ();
+    void   RunBasesConcurrently    ();
     void   InitializeLife          (mcenum_run_basis);
     void   FinalizeLife            (mcenum_run_basis);
     void   FinalizeLifeAllBases    ();
@@ -310,7 +326,7 @@ class LMI_SO AccountValue final
 
     // Detailed monthly trace.
     std::string     DebugFilename;
-    std::ofstream   DebugStream;
+    std::shared_ptr<std::ofstream> DebugStream;
     std::vector<std::string> DebugRecord;
 
     double          PriorAVGenAcct;
@@ -326,6 +342,16 @@ class LMI_SO AccountValue final
     bool            SolvingForGuarPremium;
     bool            ItLapsed;
 
+    // Incremental re-run: see ResumeAV().
+    int                                                 checkpoint_interval_ {0};
+    std::vector<std::shared_ptr<projection_checkpoint>> checkpoints_;
+
+    // See set_concurrent_bases().
+    bool            concurrent_bases_ {false};
+
+    // See set_secant_solves().
+    bool            secant_solves_ {false};
+
     std::shared_ptr<Ledger         > ledger_;
     std::shared_ptr<LedgerInvariant> ledger_invariant_;
     std::shared_ptr<LedgerVariant  > ledger_variant_;
@@ -612,6 +638,29 @@ class LMI_SO AccountValue final
     std::vector<double> SurrChg_; // Of uncertain utility.
 };
 
+/// Projection state of the current basis at the beginning of one year.
+///
+/// 'current_' is a detached copy of an AccountValue, made just before
+/// it began processing that year on the current basis. Other bases
+/// aren't captured: see AccountValue::ResumeAV(), which copies this
+/// one again, so the same checkpoint can be resumed any number of
+/// times.
+
+class LMI_SO projection_checkpoint final
+{
+    friend class AccountValue;
+
+  public:
+    int year() const {return year_;}
+
+  private:
+    int    year_         {0};
+    double solve_result_ {0.0};
+    std::shared_ptr<AccountValue const> current_;
+};
+
+LMI_SO int first_affected_year(Input const&, Input const&);
+
 //============================================================================
 inline double AccountValue::TotalAccountValue() const
 {
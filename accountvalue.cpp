@@ -107,7 +107,17 @@ showing {accesses, modifies current year, modifies future years}
 
 //============================================================================
 AccountValue::AccountValue(Input const& input)
-    :BasicValues       (Input::consummate(input))
+    :AccountValue {yare_input(Input::consummate(input))}
+{
+}
+
+/// Construct from input that has already been consummated.
+///
+/// See Input::consummate() and yare_cells(); the Input ctor above
+/// delegates to this one.
+
+AccountValue::AccountValue(yare_input const& consummated_input)
+    :BasicValues       (consummated_input)
     ,DebugFilename     {"anonymous.monthly_trace"}
     ,ledger_{new Ledger(BasicValues::GetLength(), BasicValues::ledger_type(), BasicValues::nonillustrated(), BasicValues::no_can_issue(), false)}
     ,ledger_invariant_ {new LedgerInvariant(BasicValues::GetLength())}
@@ -1080,7 +1090,17 @@ void   AccountValue::InitializeYear()
     {return;}
 bool   AccountValue::PrecedesInforceDuration(int, int)
     {return false;}
+double AccountValue::ResumeAV(projection_checkpoint const&)
+    {return RunAV();}
 void   AccountValue::SetClaims()
     {return;}
 void   AccountValue::SetProjectedCoiCharge()
     {return;}
+std::vector<std::shared_ptr<projection_checkpoint const>> AccountValue::checkpoints() const
+    {return {};}
+void   AccountValue::set_checkpoint_interval(int)
+    {return;}
+void   AccountValue::set_concurrent_bases(bool)
+    {return;}
+void   AccountValue::set_secant_solves(bool)
+    {return;}
@@ -187,13 +187,16 @@ class alarum_buf
 ///
 /// Both 'failbit' [27.6.2.5.3/8] and 'badbit' [27.6.2.1/3] must be
 /// specified in the call to exceptions().
+///
+/// Each thread has its own streams, so that messages composed on
+/// concurrent threads aren't interleaved.
 
 template<typename T>
 inline std::ostream& alert_stream()
 {
     static_assert(std::is_base_of_v<alert_buf,T>);
-    static T buffer_;
-    static std::ostream stream_(&buffer_);
+    thread_local T buffer_;
+    thread_local std::ostream stream_(&buffer_);
     stream_.clear();
     stream_.exceptions(std::ios_base::failbit | std::ios_base::badbit);
     return stream_;
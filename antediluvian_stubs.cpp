@@ -21,6 +21,8 @@
 
 #include "pchfile.hpp"
 
+#include "account_value.hpp"            // first_affected_year()
+#include "benchmark_suite.hpp"
 #include "fund_data.hpp"
 #include "gpt_server.hpp"
 #include "lingo.hpp"
@@ -42,6 +44,14 @@ namespace
 void authenticate_system()
 {}
 
+void benchmark_suite(std::string const&, std::string const&)
+{}
+
+int first_affected_year(Input const&, Input const&)
+{
+    return 0;
+}
+
 bool is_antediluvian_fork()
 {
     return true;
@@ -65,6 +75,9 @@ bool gpt_server::operator()(fs::path const&)
     return false;
 }
 
+void gpt_server::batch(std::vector<fs::path> const&, std::ostream&)
+{}
+
 template class xml_serializable<gpt_state>;
 
 gpt_state::gpt_state() = default;
@@ -102,6 +115,9 @@ bool mec_server::operator()(fs::path const&)
     return false;
 }
 
+void mec_server::batch(std::vector<fs::path> const&, std::ostream&)
+{}
+
 template class xml_serializable<mec_state>;
 
 mec_state::mec_state() = default;
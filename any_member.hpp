@@ -64,20 +64,26 @@
 
 #include "assert_lmi.hpp"
 #include "rtti_lmi.hpp"
+#include "ssize_lmi.hpp"
 #include "value_cast.hpp"
 
 #include <algorithm>                    // lower_bound()
+#include <iterator>                     // distance()
 #include <map>
+#include <memory>                       // make_shared(), shared_ptr
 #include <sstream>
 #include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <utility>                      // swap()
 #include <vector>
 
 // Definition of class placeholder.
 
-// The implicitly-defined copy ctor and copy assignment operator do
-// the right thing.
+// A placeholder describes one member of ClassType, independently of
+// any particular object. It is immutable, so one instance can be
+// shared by every object of ClassType: the object is passed to each
+// member function instead of being stored.
 
 // A virtual member template here would permit
 //    template<typename X>
@@ -86,117 +92,130 @@
 //   http://groups.google.com/groups?selm=7f6de0%24t1t%241%40nnrp1.dejanews.com
 // is one of the more complete in a thread discussing the rationale.
 
+template<typename ClassType>
 class placeholder
 {
   public:
     virtual ~placeholder();
-    virtual placeholder& assign(placeholder const&) = 0;
-    virtual placeholder& assign(std::string const&) = 0;
-    virtual placeholder* clone() const = 0;
-    virtual bool equals(placeholder const&) const = 0;
-    virtual std::string str() const = 0;
+    virtual void assign
+        (ClassType*         object
+        ,placeholder const& other
+        ,ClassType const*   other_object
+        ) const = 0;
+    virtual void assign(ClassType* object, std::string const&) const = 0;
+    virtual bool equals
+        (ClassType const*   object
+        ,placeholder const& other
+        ,ClassType const*   other_object
+        ) const = 0;
+    virtual std::string str(ClassType const* object) const = 0;
     virtual std::type_info const& type() const = 0;
 #if defined LMI_MSC
-    virtual void* defraud() const = 0;
+    virtual void* defraud(ClassType* object) const = 0;
 #endif // defined LMI_MSC
 };
 
 // Implementation of class placeholder.
 
-inline placeholder::~placeholder() = default;
+template<typename ClassType>
+placeholder<ClassType>::~placeholder() = default;
 
 // Definition of class holder.
 
 template<typename ClassType, typename ValueType>
 class holder final
-    :public placeholder
+    :public placeholder<ClassType>
 {
     // Friendship is extended to class any_member only to support its
     // cast operations.
     template<typename T> friend class any_member;
 
   public:
-    holder(ClassType*, ValueType const&);
+    explicit holder(ValueType const&);
     ~holder() override;
 
     // placeholder required implementation.
-    holder& assign(placeholder const&) override;
-    holder& assign(std::string const&) override;
-    placeholder* clone() const override;
-    bool equals(placeholder const&) const override;
-    std::string str() const override;
+    void assign
+        (ClassType*                    object
+        ,placeholder<ClassType> const& other
+        ,ClassType const*              other_object
+        ) const override;
+    void assign(ClassType* object, std::string const&) const override;
+    bool equals
+        (ClassType const*              object
+        ,placeholder<ClassType> const& other
+        ,ClassType const*              other_object
+        ) const override;
+    std::string str(ClassType const* object) const override;
     std::type_info const& type() const override;
 #if defined LMI_MSC
-    virtual void* defraud() const;
+    void* defraud(ClassType* object) const override;
 #endif // defined LMI_MSC
 
   private:
     holder(holder const&) = delete;
     holder& operator=(holder const&) = delete;
 
-    ClassType* object_;
-    ValueType held_;
+    ValueType const held_;
 };
 
 // Implementation of class holder.
 
 template<typename ClassType, typename ValueType>
-holder<ClassType,ValueType>::holder(ClassType* object, ValueType const& value)
-    :object_ {object}
-    ,held_   {value}
+holder<ClassType,ValueType>::holder(ValueType const& value)
+    :held_ {value}
 {}
 
 template<typename ClassType, typename ValueType>
 holder<ClassType,ValueType>::~holder() = default;
 
 template<typename ClassType, typename ValueType>
-holder<ClassType,ValueType>& holder<ClassType,ValueType>::assign
-    (placeholder const& other
-    )
+void holder<ClassType,ValueType>::assign
+    (ClassType*                    object
+    ,placeholder<ClassType> const& other
+    ,ClassType const*              other_object
+    ) const
 {
     LMI_ASSERT(other.type() == type());
     typedef holder<ClassType,ValueType> holder_type;
     holder_type const& z = static_cast<holder_type const&>(other);
-    LMI_ASSERT(z.object_);
-    LMI_ASSERT(object_);
-    object_->*held_ = (z.object_)->*(z.held_);
-    return *this;
+    LMI_ASSERT(other_object);
+    LMI_ASSERT(object);
+    object->*held_ = other_object->*(z.held_);
 }
 
 template<typename ClassType, typename ValueType>
-holder<ClassType,ValueType>& holder<ClassType,ValueType>::assign
-    (std::string const& s
-    )
-{
-    LMI_ASSERT(object_);
-    object_->*held_ = value_cast(s, object_->*held_);
-    return *this;
-}
-
-template<typename ClassType, typename ValueType>
-placeholder* holder<ClassType,ValueType>::clone() const
+void holder<ClassType,ValueType>::assign
+    (ClassType*         object
+    ,std::string const& s
+    ) const
 {
-    return new holder(object_, held_);
+    LMI_ASSERT(object);
+    object->*held_ = value_cast(s, object->*held_);
 }
 
 template<typename ClassType, typename ValueType>
-bool holder<ClassType,ValueType>::equals(placeholder const& other) const
+bool holder<ClassType,ValueType>::equals
+    (ClassType const*              object
+    ,placeholder<ClassType> const& other
+    ,ClassType const*              other_object
+    ) const
 {
-    // Deemed unequal if types differ or either object_ is null.
+    // Deemed unequal if types differ or either object is null.
     if(other.type() != type())
         {
         return false;
         }
     typedef holder<ClassType,ValueType> holder_type;
     holder_type const& z = static_cast<holder_type const&>(other);
-    return object_ && z.object_ && (z.object_)->*(z.held_) == object_->*held_;
+    return object && other_object && other_object->*(z.held_) == object->*held_;
 }
 
 template<typename ClassType, typename ValueType>
-std::string holder<ClassType,ValueType>::str() const
+std::string holder<ClassType,ValueType>::str(ClassType const* object) const
 {
-    LMI_ASSERT(object_);
-    return value_cast<std::string>(object_->*held_);
+    LMI_ASSERT(object);
+    return value_cast<std::string>(object->*held_);
 }
 
 template<typename ClassType, typename ValueType>
@@ -207,10 +226,10 @@ std::type_info const& holder<ClassType,ValueType>::type() const
 
 #if defined LMI_MSC
 template<typename ClassType, typename ValueType>
-void* holder<ClassType,ValueType>::defraud() const
+void* holder<ClassType,ValueType>::defraud(ClassType* object) const
 {
-    LMI_ASSERT(object_);
-    return &(object_->*held_);
+    LMI_ASSERT(object);
+    return &(object->*held_);
 }
 #endif // defined LMI_MSC
 
@@ -218,9 +237,15 @@ void* holder<ClassType,ValueType>::defraud() const
 
 // This class is necessarily Assignable, so that a std::map can hold it.
 
+// An any_member binds an object to a shared description of one of
+// its members. Copying an any_member therefore allocates nothing.
+
 template<typename ClassType>
 class any_member;
 
+template<typename ClassType>
+class MemberSymbolTable;
+
 template<typename MemberType, typename ClassType>
 MemberType* exact_cast(any_member<ClassType>&);
 
@@ -239,8 +264,12 @@ class any_member final
     template<typename MemberType, typename CT>
     friend MemberType* member_cast(any_member<CT>&);
 
+    friend class MemberSymbolTable<ClassType>;
+
     friend struct any_member_test;
 
+    typedef std::shared_ptr<placeholder<ClassType> const> content_type;
+
   public:
     any_member();
     any_member(any_member const&);
@@ -260,6 +289,8 @@ class any_member final
     std::type_info const& type() const override;
 
   private:
+    any_member(ClassType*, content_type const&);
+
     template<typename ExactMemberType>
     ExactMemberType* exact_cast();
 
@@ -267,7 +298,7 @@ class any_member final
     any_member& assign(std::string const&) override;
 
     ClassType* object_;
-    placeholder* content_;
+    content_type content_;
 };
 
 // Implementation of class any_member.
@@ -275,27 +306,33 @@ class any_member final
 template<typename ClassType>
 any_member<ClassType>::any_member()
     :object_  {nullptr}
-    ,content_ {nullptr}
+    ,content_ {}
 {}
 
 template<typename ClassType>
 any_member<ClassType>::any_member(any_member const& other)
     :any_entity {other}
     ,object_    {other.object_}
-    ,content_   {other.content_ ? other.content_->clone() : nullptr}
+    ,content_   {other.content_}
 {}
 
 template<typename ClassType>
-any_member<ClassType>::~any_member()
-{
-    delete content_;
-}
+any_member<ClassType>::~any_member() = default;
 
 template<typename ClassType>
 template<typename ValueType>
 any_member<ClassType>::any_member(ClassType* object, ValueType const& value)
     :object_  {object}
-    ,content_ {new holder<ClassType,ValueType>(object, value)}
+    ,content_ {std::make_shared<holder<ClassType,ValueType> const>(value)}
+{}
+
+template<typename ClassType>
+any_member<ClassType>::any_member
+    (ClassType*          object
+    ,content_type const& content
+    )
+    :object_  {object}
+    ,content_ {content}
 {}
 
 template<typename ClassType>
@@ -317,7 +354,7 @@ any_member<ClassType>& any_member<ClassType>::operator=
     // symbol table.
     LMI_ASSERT(other.content_);
     LMI_ASSERT(content_);
-    content_->assign(*other.content_);
+    content_->assign(object_, *other.content_, other.object_);
     return *this;
 }
 
@@ -332,7 +369,11 @@ bool any_member<ClassType>::operator==
     (any_member<ClassType> const& other
     ) const
 {
-    return content_ && other.content_ && content_->equals(*other.content_);
+    return
+           content_
+        && other.content_
+        && content_->equals(object_, *other.content_, other.object_)
+        ;
 }
 
 template<typename ClassType>
@@ -347,7 +388,7 @@ template<typename ClassType>
 std::string any_member<ClassType>::str() const
 {
     LMI_ASSERT(content_);
-    return content_->str();
+    return content_->str(object_);
 }
 
 template<typename ClassType>
@@ -368,11 +409,11 @@ ExactMemberType* any_member<ClassType>::exact_cast()
     typedef holder<ClassType,pmd_type> holder_type;
     LMI_ASSERT(content_);
 #if !defined LMI_MSC
-    pmd_type pmd = static_cast<holder_type*>(content_)->held_;
+    pmd_type pmd = static_cast<holder_type const*>(content_.get())->held_;
     LMI_ASSERT(object_);
     return &(object_->*pmd);
 #else  // defined LMI_MSC
-    return static_cast<ExactMemberType*>(content_->defraud());
+    return static_cast<ExactMemberType*>(content_->defraud(object_));
 #endif // defined LMI_MSC
 }
 
@@ -380,7 +421,7 @@ template<typename ClassType>
 any_member<ClassType>& any_member<ClassType>::assign(std::string const& s)
 {
     LMI_ASSERT(content_);
-    content_->assign(s);
+    content_->assign(object_, s);
     return *this;
 }
 
@@ -515,19 +556,42 @@ MemberType const* member_cast(any_member<ClassType> const& member)
 
 // Definition of class MemberSymbolTable.
 
-// By its nature, this class is uncopyable: it holds a map of
-// pointers to member, which need to be initialized instead of copied
-// when a derived class is copied.
+// By its nature, this class is uncopyable: it holds pointers to
+// members of a particular object, which need to be initialized
+// instead of copied when a derived class is copied.
 //
 // A do-nothing constructor is specified in order to prevent compilers
 // from warning of its absence. It's protected because this class
 // should not be instantiated as a most-derived object.
+//
+// Everything that doesn't depend on a particular object--member
+// names, and descriptions of the members they designate--is kept in
+// a single table per class, built by ascribe() as the first object
+// of the class is constructed. Every object of the same class must
+// ascribe the same members in the same order, which is naturally the
+// case when ascribe() is called only by constructors. Each object
+// holds only a vector of any_member bindings, in ascription order,
+// so that constructing or copying an object neither allocates a node
+// per member nor looks any member up by name.
+//
+// The class table has the same threading issues as a Meyers
+// singleton: the first object of each class must be constructed
+// before any other thread constructs one.
 
 template<typename ClassType>
 class MemberSymbolTable
 {
-    typedef std::map<std::string, any_member<ClassType>> member_map_type;
-    typedef typename member_map_type::value_type member_pair_type;
+    typedef std::shared_ptr<placeholder<ClassType> const> content_type;
+
+    struct class_table
+    {
+        // Ascription order.
+        std::vector<std::string> ascribed_names;
+        std::vector<content_type> contents;
+        // Alphabetical order, with indices into the vectors above.
+        std::vector<std::string> sorted_names;
+        std::vector<int> sorted_indices;
+    };
 
   public:
     virtual ~MemberSymbolTable();
@@ -543,27 +607,46 @@ class MemberSymbolTable
     MemberSymbolTable();
 
     template<typename ValueType, typename SameOrBaseClassType>
-    void ascribe(std::string const&, ValueType SameOrBaseClassType::*);
+    void ascribe(char const*, ValueType SameOrBaseClassType::*);
 
   private:
     MemberSymbolTable(MemberSymbolTable const&) = delete;
     MemberSymbolTable& operator=(MemberSymbolTable const&) = delete;
 
+    static class_table& table_for_this_class();
+
+    int index_of(std::string const&) const;
+
     [[noreturn]]
     void complain_that_no_such_member_is_ascribed(std::string const&) const;
 
-    member_map_type map_;
-    std::vector<std::string> member_names_;
+    // A reference is kept, rather than calling table_for_this_class()
+    // wherever it's needed, so that an object uses the table that its
+    // own constructor filled even if ClassType's members are accessed
+    // from another shared library, which may have its own instance of
+    // the function-local static object.
+    class_table& table_;
+    std::vector<any_member<ClassType>> members_;
 };
 
 // Implementation of class MemberSymbolTable.
 
 template<typename ClassType>
-MemberSymbolTable<ClassType>::MemberSymbolTable() = default;
+MemberSymbolTable<ClassType>::MemberSymbolTable()
+    :table_ {table_for_this_class()}
+{}
 
 template<typename ClassType>
 MemberSymbolTable<ClassType>::~MemberSymbolTable() = default;
 
+template<typename ClassType>
+typename MemberSymbolTable<ClassType>::class_table&
+MemberSymbolTable<ClassType>::table_for_this_class()
+{
+    static class_table z;
+    return z;
+}
+
 // operator[]() returns a known member; unlike std::map::operator[](),
 // it never adds a new pair to the map, and it complains if such an
 // addition is attempted.
@@ -585,16 +668,23 @@ void MemberSymbolTable<ClassType>::complain_that_no_such_member_is_ascribed
 }
 
 template<typename ClassType>
-any_member<ClassType>& MemberSymbolTable<ClassType>::operator[]
-    (std::string const& s
-    )
+int MemberSymbolTable<ClassType>::index_of(std::string const& s) const
 {
-    auto i = map_.find(s);
-    if(map_.end() == i)
+    std::vector<std::string> const& v = table_.sorted_names;
+    auto const i = std::lower_bound(v.begin(), v.end(), s);
+    if(v.end() == i || s != *i)
         {
         complain_that_no_such_member_is_ascribed(s);
         }
-    return i->second;
+    return table_.sorted_indices[std::distance(v.begin(), i)];
+}
+
+template<typename ClassType>
+any_member<ClassType>& MemberSymbolTable<ClassType>::operator[]
+    (std::string const& s
+    )
+{
+    return members_[index_of(s)];
 }
 
 template<typename ClassType>
@@ -602,18 +692,13 @@ any_member<ClassType> const& MemberSymbolTable<ClassType>::operator[]
     (std::string const& s
     ) const
 {
-    auto const i = map_.find(s);
-    if(map_.end() == i)
-        {
-        complain_that_no_such_member_is_ascribed(s);
-        }
-    return i->second;
+    return members_[index_of(s)];
 }
 
 template<typename ClassType>
 template<typename ValueType, typename SameOrBaseClassType>
 void MemberSymbolTable<ClassType>::ascribe
-    (std::string const& s
+    (char const* s
     ,ValueType SameOrBaseClassType::* p2m
     )
 {
@@ -632,21 +717,51 @@ void MemberSymbolTable<ClassType>::ascribe
             >::value
         );
 
+    int const n = lmi::ssize(members_);
+    if(lmi::ssize(table_.contents) == n)
+        {
+        // This member is being ascribed for the first time, so add
+        // it to the class table. The only alternative is that it has
+        // already been ascribed by a previous object of this class.
+        std::vector<std::string>& v = table_.sorted_names;
+        auto const i = std::lower_bound(v.begin(), v.end(), s);
+        LMI_ASSERT(v.end() == i || s != *i);
+        table_.sorted_indices.insert
+            (table_.sorted_indices.begin() + std::distance(v.begin(), i)
+            ,n
+            );
+        v.insert(i, s);
+        table_.ascribed_names.push_back(s);
+        table_.contents.push_back
+            (std::make_shared<holder<ClassType,ValueType SameOrBaseClassType::*> const>(p2m)
+            );
+        }
+    else
+        {
+        LMI_ASSERT(table_.ascribed_names[n] == s);
+        }
+
+    if(members_.empty())
+        {
+        members_.reserve(table_.contents.size());
+        }
     ClassType* class_object = static_cast<ClassType*>(this);
-    map_.insert(member_pair_type(s, any_member<ClassType>(class_object, p2m)));
-    // TODO ?? This would appear to be O(N^2).
-    auto i = std::lower_bound(member_names_.begin(), member_names_.end(), s);
-    member_names_.insert(i, s);
+    members_.push_back(any_member<ClassType>(class_object, table_.contents[n]));
 }
 
+/// Copy all members from another object of the same class.
+///
+/// Members are visited in ascription order, so no name is looked up.
+
 template<typename ClassType>
 MemberSymbolTable<ClassType>& MemberSymbolTable<ClassType>::assign
     (MemberSymbolTable<ClassType> const& z
     )
 {
-    for(auto const& i : member_names())
+    LMI_ASSERT(members_.size() == z.members_.size());
+    for(int i = 0; i < lmi::ssize(members_); ++i)
         {
-        operator[](i) = z[i];
+        members_[i] = z.members_[i];
         }
     return *this;
 }
@@ -656,9 +771,10 @@ bool MemberSymbolTable<ClassType>::equals
     (MemberSymbolTable<ClassType> const& z
     ) const
 {
-    for(auto const& i : member_names())
+    LMI_ASSERT(members_.size() == z.members_.size());
+    for(int i = 0; i < lmi::ssize(members_); ++i)
         {
-        if(z[i] != operator[](i))
+        if(z.members_[i] != members_[i])
             {
             return false;
             }
@@ -671,7 +787,7 @@ std::vector<std::string> const& MemberSymbolTable<ClassType>::member_names
     (
     ) const
 {
-    return member_names_;
+    return table_.sorted_names;
 }
 
 /// Implementation of free function template member_state(), which
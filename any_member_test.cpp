@@ -346,6 +346,18 @@ void any_member_test::test_any_member()
     s.MemberSymbolTable<S>::assign(s_const);
     BOOST_TEST(s_const == s      );
 
+    // Member names are held in a table shared by all objects of the
+    // same class, but each object's members are its own.
+
+    BOOST_TEST(&s.member_names() == &s_const.member_names());
+    BOOST_TEST_EQUAL(6, s.member_names().size());
+    BOOST_TEST_EQUAL("d0", s.member_names().front());
+    BOOST_TEST_EQUAL("x0", s.member_names().back());
+    std::string const i1_const = s_const["i1"].str();
+    s["i1"] = "12345";
+    BOOST_TEST_EQUAL(s.i1, 12345);
+    BOOST_TEST_EQUAL(s_const["i1"].str(), i1_const);
+
     // Test no-such-member diagnostic for both const and non-const
     // subscripting operators.
 
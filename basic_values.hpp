@@ -81,6 +81,7 @@ class LMI_SO BasicValues
 {
   public:
     BasicValues(Input const& input);
+    explicit BasicValues(yare_input const& input);
     BasicValues // GPT server only.
         (std::string const& a_ProductName
         ,mcenum_gender      a_Gender
@@ -115,6 +116,8 @@ class LMI_SO BasicValues
     auto const& partial_mortality_tpx() const {return partial_mortality_tpx_;}
     auto const& partial_mortality_lx () const {return partial_mortality_lx_ ;}
 
+    e_actuarial_table_method coi_inforce_reentry() const {return CoiInforceReentry;}
+
     double                InvestmentManagementFee()    const;
 
     yare_input                          yare_input_;
@@ -201,6 +204,11 @@ class LMI_SO BasicValues
     round_to<double> const& round_minutiae          () const {return round_minutiae_          ;}
 
   protected:
+    /// Copying shares every shared_ptr member. A derived class that
+    /// copies itself must replace any pointee it modifies.
+
+    BasicValues(BasicValues const&) = default;
+
     double GetModalMinPrem
         (int         a_year
         ,mcenum_mode a_mode
@@ -386,7 +394,6 @@ class LMI_SO BasicValues
     std::vector<double>     TieredMECharges;
 
   private:
-    BasicValues(BasicValues const&) = delete;
     BasicValues& operator=(BasicValues const&) = delete;
 
     void set_partial_mortality();
@@ -46,6 +46,12 @@ char const* GuaranteedTableFile() {return "/opt/lmi/data/qx_cso";}
 
 //============================================================================
 BasicValues::BasicValues(Input const& input)
+    :BasicValues {yare_input(input)}
+{
+}
+
+//============================================================================
+BasicValues::BasicValues(yare_input const& input)
     :yare_input_              {input}
     ,product_                 {}
     ,database_
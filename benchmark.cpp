@@ -0,0 +1,223 @@
+// Timings for performance-regression tracking.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#include "pchfile.hpp"
+
+#include "benchmark.hpp"
+
+#include "alert.hpp"
+#include "assert_lmi.hpp"
+#include "miscellany.hpp"               // rtrim()
+#include "ssize_lmi.hpp"
+#include "timer.hpp"
+
+#include <algorithm>                    // find_if(), sort()
+#include <chrono>
+#include <cmath>                        // ceil()
+#include <iomanip>
+#include <istream>
+#include <numeric>                      // accumulate()
+#include <ostream>
+#include <sstream>
+
+namespace
+{
+char const* const header = "name\truns\tleast\tp50\tp90\tp99\tmean";
+} // Unnamed namespace.
+
+/// Time an operation repeatedly, keeping every observation.
+///
+/// The stopping criterion is AliquotTimer's (q.v.), and so is the
+/// treatment of the first observation: it's discarded, unless it
+/// alone exceeds the limit, in which case it's the only one kept.
+/// Unlike AliquotTimer, this retains all observations, so that their
+/// distribution, not just their minimum, can be summarized.
+///
+/// Time spent is measured by a steady clock, not by summing those
+/// observations: an operation faster than the timer's resolution
+/// would otherwise seem to take no time, and never stop.
+
+std::vector<double> sample_timings
+    (std::function<void()> const& f
+    ,double                       max_seconds
+    )
+{
+    LMI_ASSERT(0.0 < max_seconds);
+    Timer timer;
+    f();
+    double const initial_trial_time = timer.stop().elapsed_seconds();
+    if(max_seconds < initial_trial_time)
+        {
+        return {initial_trial_time};
+        }
+
+    using clock = std::chrono::steady_clock;
+    clock::time_point const start = clock::now();
+    std::chrono::duration<double> total {0.0};
+    std::vector<double> z;
+    while(total.count() < 0.01 * max_seconds || lmi::ssize(z) < 100 && total.count() < max_seconds)
+        {
+        timer.restart();
+        f();
+        z.push_back(timer.stop().elapsed_seconds());
+        total = clock::now() - start;
+        }
+    return z;
+}
+
+/// Nearest-rank percentile of sorted observations.
+///
+/// Precondition: 'sorted' is nonempty and sorted in ascending order,
+/// and 0 < p <= 100.
+
+double percentile(std::vector<double> const& sorted, double p)
+{
+    LMI_ASSERT(!sorted.empty());
+    LMI_ASSERT(0.0 < p && p <= 100.0);
+    LMI_ASSERT(std::is_sorted(sorted.begin(), sorted.end()));
+    int const rank = static_cast<int>(std::ceil(p * lmi::ssize(sorted) / 100.0));
+    return sorted[std::max(1, rank) - 1];
+}
+
+benchmark_result summarize
+    (std::string const&  name
+    ,std::vector<double> seconds
+    )
+{
+    LMI_ASSERT(!seconds.empty());
+    std::sort(seconds.begin(), seconds.end());
+    benchmark_result z;
+    z.name  = name;
+    z.runs  = lmi::ssize(seconds);
+    z.least = seconds.front();
+    z.p50   = percentile(seconds, 50.0);
+    z.p90   = percentile(seconds, 90.0);
+    z.p99   = percentile(seconds, 99.0);
+    z.mean  = std::accumulate(seconds.begin(), seconds.end(), 0.0) / z.runs;
+    return z;
+}
+
+/// Write results as tab-delimited text, with a header line.
+///
+/// Names must not contain tabs or newlines.
+
+void write_benchmark_results
+    (std::ostream&                        os
+    ,std::vector<benchmark_result> const& results
+    )
+{
+    os << header << '\n';
+    os << std::scientific << std::setprecision(6);
+    for(auto const& i : results)
+        {
+        LMI_ASSERT(std::string::npos == i.name.find_first_of("\t\n"));
+        os
+            <<         i.name
+            << '\t' << i.runs
+            << '\t' << i.least
+            << '\t' << i.p50
+            << '\t' << i.p90
+            << '\t' << i.p99
+            << '\t' << i.mean
+            << '\n'
+            ;
+        }
+}
+
+/// Read results written by write_benchmark_results().
+
+std::vector<benchmark_result> read_benchmark_results(std::istream& is)
+{
+    std::string line;
+    std::getline(is, line);
+    rtrim(line, "\r");
+    if(header != line)
+        {
+        alarum() << "Benchmark results lack expected header." << LMI_FLUSH;
+        }
+
+    std::vector<benchmark_result> z;
+    while(std::getline(is, line))
+        {
+        rtrim(line, "\r");
+        if(line.empty())
+            {
+            continue;
+            }
+        std::string::size_type const tab = line.find('\t');
+        benchmark_result r;
+        r.name = line.substr(0, tab);
+        std::istringstream iss(std::string::npos == tab ? "" : line.substr(1 + tab));
+        iss >> r.runs >> r.least >> r.p50 >> r.p90 >> r.p99 >> r.mean;
+        if(!iss)
+            {
+            alarum() << "Invalid benchmark result '" << line << "'." << LMI_FLUSH;
+            }
+        z.push_back(r);
+        }
+    return z;
+}
+
+/// Compare results to a baseline; return the number of regressions.
+///
+/// An operation has regressed if its least time exceeds the
+/// baseline's by more than the given proportion. The least time is
+/// compared because it's the most stable statistic: see
+///   https://lists.nongnu.org/archive/html/lmi/2017-05/msg00005.html
+/// Write one line per result, showing the change in its least time
+/// and whether it's new or has regressed.
+
+int compare_to_baseline
+    (std::vector<benchmark_result> const& results
+    ,std::vector<benchmark_result> const& baseline
+    ,double                               tolerance
+    ,std::ostream&                        os
+    )
+{
+    int regressions = 0;
+    for(auto const& i : results)
+        {
+        auto const j = std::find_if
+            (baseline.begin()
+            ,baseline.end()
+            ,[&i](auto const& k) {return i.name == k.name;}
+            );
+        os << "  " << std::left << std::setw(40) << i.name << std::right;
+        if(baseline.end() == j)
+            {
+            os << "     new\n";
+            continue;
+            }
+        double const change = (0.0 < j->least) ? i.least / j->least - 1.0 : 0.0;
+        os
+            << std::fixed << std::setprecision(1) << std::showpos
+            << std::setw(8) << 100.0 * change << '%'
+            << std::noshowpos
+            ;
+        if(tolerance < change)
+            {
+            ++regressions;
+            os << "  REGRESSION";
+            }
+        os << '\n';
+        }
+    return regressions;
+}
@@ -0,0 +1,74 @@
+// Timings for performance-regression tracking.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#ifndef benchmark_hpp
+#define benchmark_hpp
+
+#include "config.hpp"
+
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// Summary statistics for repeated timings of one operation.
+///
+/// Times are in seconds. Percentiles use the nearest-rank method, so
+/// each is one of the observed times.
+
+struct benchmark_result
+{
+    std::string name  {};
+    int         runs  {0};
+    double      least {0.0};
+    double      p50   {0.0};
+    double      p90   {0.0};
+    double      p99   {0.0};
+    double      mean  {0.0};
+};
+
+std::vector<double> sample_timings
+    (std::function<void()> const& f
+    ,double                       max_seconds
+    );
+
+double percentile(std::vector<double> const& sorted, double p);
+
+benchmark_result summarize
+    (std::string const&  name
+    ,std::vector<double> seconds
+    );
+
+void write_benchmark_results
+    (std::ostream&                        os
+    ,std::vector<benchmark_result> const& results
+    );
+
+std::vector<benchmark_result> read_benchmark_results(std::istream&);
+
+int compare_to_baseline
+    (std::vector<benchmark_result> const& results
+    ,std::vector<benchmark_result> const& baseline
+    ,double                               tolerance
+    ,std::ostream&                        os
+    );
+
+#endif // benchmark_hpp
@@ -0,0 +1,295 @@
+// Benchmarks of principal operations.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#include "pchfile.hpp"
+
+#include "benchmark_suite.hpp"
+
+#include "alert.hpp"
+#include "benchmark.hpp"
+#include "data_directory.hpp"           // AddDataDir()
+#include "dbdict.hpp"
+#include "emit_ledger.hpp"
+#include "fund_data.hpp"
+#include "gpt_input.hpp"
+#include "gpt_server.hpp"
+#include "handle_exceptions.hpp"        // report_exception()
+#include "illustrator.hpp"
+#include "input.hpp"
+#include "ledger.hpp"
+#include "ledger_text_formats.hpp"      // PrintLedgerFlatText()
+#include "lingo.hpp"
+#include "mc_enum_type_enums.hpp"
+#include "mec_input.hpp"
+#include "mec_server.hpp"
+#include "miscellany.hpp"               // ios_out_trunc_binary()
+#include "multiple_cell_document.hpp"
+#include "product_data.hpp"
+#include "rounding_rules.hpp"
+#include "stratified_charges.hpp"
+#include "timer.hpp"
+
+#include <boost/filesystem/fstream.hpp>
+#include <boost/filesystem/path.hpp>
+
+#include <functional>                   // bind(), cref()
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>                      // pair
+#include <vector>
+
+namespace
+{
+/// Time an operation, adding its summary to 'results'.
+///
+/// An operation that fails is reported and omitted.
+
+void time_operation
+    (std::vector<benchmark_result>& results
+    ,std::string const&             name
+    ,std::function<void()> const&   f
+    ,double                         max_seconds = 1.0
+    )
+{
+    try
+        {
+        results.push_back(summarize(name, sample_timings(f, max_seconds)));
+        std::cout
+            << "  "
+            << name
+            << ": "
+            << Timer::elapsed_msec_str(results.back().least)
+            << " least of "
+            << results.back().runs
+            << " runs"
+            << std::endl
+            ;
+        }
+    catch(...)
+        {
+        std::cout << "  " << name << ": failed" << std::endl;
+        report_exception();
+        }
+}
+
+void read_product_files(std::string const& product_name)
+{
+    product_data       p(product_name);
+    DBDictionary       d(AddDataDir(p.datum("DatabaseFilename")));
+    FundData           f(AddDataDir(p.datum("FundFilename"    )));
+    lingo              l(AddDataDir(p.datum("LingoFilename"   )));
+    rounding_rules     r(AddDataDir(p.datum("RoundingFilename")));
+    stratified_charges s(AddDataDir(p.datum("TierFilename"    )));
+}
+
+void read_census(std::string const& filename)
+{
+    multiple_cell_document z(filename);
+}
+
+void write_flat_text(Ledger const& ledger)
+{
+    std::ostringstream oss;
+    PrintLedgerFlatText(ledger, oss);
+}
+
+/// Time lmi's principal operations.
+///
+/// This extends the timings in self_test(), which are kept as they
+/// are for comparability with the 'Speed_*' files. It measures:
+///  - reading product files, bypassing their cache;
+///  - single cells of every supported ledger type, and solves;
+///  - censuses of 100, 1000, and 10000 cells, run in each order;
+///  - reading census files;
+///  - each type of output that doesn't require wx; and
+///  - the GPT and MEC servers.
+/// PDF output requires wx, so it is measured by wx_test instead.
+///
+/// Censuses are timed for up to thirty seconds each, other operations
+/// for up to one second: see sample_timings(). The largest censuses
+/// are therefore run only once.
+///
+/// Files whose names begin with "CLI_benchmark" are written to the
+/// current directory.
+
+std::vector<benchmark_result> run_benchmarks()
+{
+    std::vector<benchmark_result> z;
+    std::string const name("CLI_benchmark");
+
+    time_operation(z, "product load", std::bind(read_product_files, "sample"));
+
+    Input cell;
+    cell["SolveType"         ] = "No solve";
+    cell["Gender"            ] = "Male";
+    cell["Smoking"           ] = "Nonsmoker";
+    cell["UnderwritingClass" ] = "Standard";
+    cell["GeneralAccountRate"] = "0.06";
+    cell["Payment"           ] = "20000.0";
+    cell["SpecifiedAmount"   ] = "1000000.0";
+    cell["SolveToWhich"      ] = "Maturity";
+
+    illustrator calculator(mce_emit_nothing);
+    // One product for each ledger type that isn't obsolete.
+    std::vector<std::string> const products
+        {"sample2naic", "sample2finra", "sample2prosp", "sample2gpp", "sample2ipp"};
+    for(auto const& i : products)
+        {
+        Input input {cell};
+        input["ProductName"] = i;
+        input.RealizeAllSequenceInput();
+        time_operation
+            (z
+            ,"cell " + i + ", no solve"
+            ,std::bind(calculator, name, input)
+            );
+        for(auto const& j : {"Specified amount", "Employee premium"})
+            {
+            input["SolveType"] = j;
+            time_operation
+                (z
+                ,"cell " + i + ", solve for " + j
+                ,std::bind(calculator, name, input)
+                );
+            }
+        }
+
+    cell["ProductName"] = "sample2naic";
+    cell.RealizeAllSequenceInput();
+
+    illustrator census_calculator(mce_emit_quietly);
+    for(int n : {100, 1000, 10000})
+        {
+        for(auto const& j : {"Life by life", "Month by month"})
+            {
+            std::vector<Input> cells(n, cell);
+            for(auto& k : cells)
+                {
+                k["RunOrder"] = j;
+                }
+            time_operation
+                (z
+                ,"census " + std::to_string(n) + ", " + j
+                ,std::bind(census_calculator, name + ".cns", cells)
+                ,30.0
+                );
+            }
+        }
+
+    // Census files of 10000 cells are too large to be worth writing.
+    for(int n : {100, 1000})
+        {
+        std::string const filename = name + std::to_string(n) + ".cns";
+        {
+        fs::ofstream ofs(filename, ios_out_trunc_binary());
+        multiple_cell_document(cell, std::vector<Input>(n, cell)).write(ofs);
+        }
+        time_operation
+            (z
+            ,"census load " + std::to_string(n)
+            ,std::bind(read_census, filename)
+            ,30.0
+            );
+        }
+
+    calculator(name, cell);
+    Ledger const& ledger = *calculator.principal_ledger();
+    time_operation(z, "emit text_stream", std::bind(write_flat_text, std::cref(ledger)));
+    std::vector<std::pair<std::string,mcenum_emission>> const emissions
+        {{"test_data"   , mce_emit_test_data   }
+        ,{"spreadsheet" , mce_emit_spreadsheet }
+        ,{"group_roster", mce_emit_group_roster}
+        ,{"custom_0"    , mce_emit_custom_0    }
+        ,{"custom_1"    , mce_emit_custom_1    }
+        };
+    for(auto const& i : emissions)
+        {
+        time_operation
+            (z
+            ,"emit " + i.first
+            ,std::bind(emit_ledger, fs::path(name), std::cref(ledger), i.second)
+            );
+        }
+
+    time_operation
+        (z
+        ,"gpt server"
+        ,std::bind(gpt_server(mce_emit_nothing), fs::path(name + ".gpt"), gpt_input())
+        );
+    time_operation
+        (z
+        ,"mec server"
+        ,std::bind(mec_server(mce_emit_nothing), fs::path(name + ".mec"), mec_input())
+        );
+
+    return z;
+}
+} // Unnamed namespace.
+
+/// Run benchmarks, writing results to a file.
+///
+/// If a baseline file is named, compare the results to it, and signal
+/// an error if any operation has regressed by more than ten percent:
+/// see compare_to_baseline().
+
+void benchmark_suite
+    (std::string const& results_path
+    ,std::string const& baseline_path
+    )
+{
+    std::cout << "Benchmarks:" << std::endl;
+    std::vector<benchmark_result> const results = run_benchmarks();
+    {
+    fs::ofstream ofs(results_path, ios_out_trunc_binary());
+    write_benchmark_results(ofs, results);
+    }
+
+    if(baseline_path.empty())
+        {
+        return;
+        }
+    fs::ifstream ifs(baseline_path);
+    if(!ifs)
+        {
+        alarum()
+            << "Unable to read baseline '"
+            << baseline_path
+            << "'."
+            << LMI_FLUSH
+            ;
+        }
+    std::cout << "Change from baseline '" << baseline_path << "':" << std::endl;
+    int const regressions = compare_to_baseline
+        (results
+        ,read_benchmark_results(ifs)
+        ,0.10
+        ,std::cout
+        );
+    if(0 != regressions)
+        {
+        alarum()
+            << regressions
+            << " benchmarks regressed by more than ten percent."
+            << LMI_FLUSH
+            ;
+        }
+}
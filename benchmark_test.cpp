@@ -0,0 +1,167 @@
+// Timings for performance-regression tracking--unit test.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#include "pchfile.hpp"
+
+#include "benchmark.hpp"
+
+#include "ssize_lmi.hpp"
+#include "test_tools.hpp"
+
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+int mete_count = 0;
+
+void mete_count_calls()
+{
+    ++mete_count;
+}
+
+void mete_nothing()
+{
+}
+} // Unnamed namespace.
+
+void test_percentile()
+{
+    std::vector<double> const v {1.0, 2.0, 3.0, 4.0};
+    BOOST_TEST_EQUAL(1.0, percentile(v,   1.0));
+    BOOST_TEST_EQUAL(1.0, percentile(v,  25.0));
+    BOOST_TEST_EQUAL(2.0, percentile(v,  50.0));
+    BOOST_TEST_EQUAL(4.0, percentile(v,  90.0));
+    BOOST_TEST_EQUAL(4.0, percentile(v, 100.0));
+
+    BOOST_TEST_EQUAL(7.0, percentile({7.0}, 50.0));
+
+    BOOST_TEST_THROW
+        (percentile(v, 0.0)
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Assertion.*failed")
+        );
+    BOOST_TEST_THROW
+        (percentile({2.0, 1.0}, 50.0)
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Assertion.*failed")
+        );
+}
+
+void test_summarize()
+{
+    // Observations needn't be sorted.
+    benchmark_result const r = summarize("x", {4.0, 1.0, 3.0, 2.0});
+    BOOST_TEST_EQUAL("x", r.name );
+    BOOST_TEST_EQUAL(4  , r.runs );
+    BOOST_TEST_EQUAL(1.0, r.least);
+    BOOST_TEST_EQUAL(2.0, r.p50  );
+    BOOST_TEST_EQUAL(4.0, r.p90  );
+    BOOST_TEST_EQUAL(4.0, r.p99  );
+    BOOST_TEST_EQUAL(2.5, r.mean );
+}
+
+void test_sampling()
+{
+    mete_count = 0;
+    std::vector<double> const v = sample_timings(mete_count_calls, 0.01);
+    // The first trial is discarded. An operation this fast is run
+    // more than a hundred times, to fill one percent of the limit.
+    BOOST_TEST(100 < lmi::ssize(v));
+    BOOST_TEST_EQUAL(mete_count, 1 + lmi::ssize(v));
+
+    BOOST_TEST_THROW
+        (sample_timings(mete_nothing, 0.0)
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Assertion.*failed")
+        );
+}
+
+void test_round_trip()
+{
+    std::vector<benchmark_result> const v
+        {summarize("cell, no solve"   , {0.25, 0.5})
+        ,summarize("census 100, x"    , {3.0})
+        };
+    std::stringstream ss;
+    write_benchmark_results(ss, v);
+    std::vector<benchmark_result> const w = read_benchmark_results(ss);
+    BOOST_TEST_EQUAL(2               , lmi::ssize(w));
+    BOOST_TEST_EQUAL("cell, no solve", w[0].name  );
+    BOOST_TEST_EQUAL(2               , w[0].runs  );
+    BOOST_TEST_EQUAL(0.25            , w[0].least );
+    BOOST_TEST_EQUAL(0.375           , w[0].mean  );
+    BOOST_TEST_EQUAL("census 100, x" , w[1].name  );
+    BOOST_TEST_EQUAL(3.0             , w[1].p99   );
+
+    std::istringstream bad_header("name\truns\n");
+    BOOST_TEST_THROW
+        (read_benchmark_results(bad_header)
+        ,std::runtime_error
+        ,"Benchmark results lack expected header."
+        );
+
+    std::istringstream bad_line
+        ("name\truns\tleast\tp50\tp90\tp99\tmean\n"
+         "x\t1\t2\n"
+        );
+    BOOST_TEST_THROW
+        (read_benchmark_results(bad_line)
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Invalid benchmark result")
+        );
+}
+
+void test_comparison()
+{
+    std::vector<benchmark_result> const baseline
+        {summarize("a", {1.0})
+        ,summarize("b", {1.0})
+        ,summarize("c", {1.0})
+        };
+    std::vector<benchmark_result> const results
+        {summarize("a", {1.05})
+        ,summarize("b", {1.25})
+        ,summarize("c", {0.5})
+        ,summarize("d", {1.0})
+        };
+    std::ostringstream oss;
+    BOOST_TEST_EQUAL(1, compare_to_baseline(results, baseline, 0.10, oss));
+    std::string const s = oss.str();
+    BOOST_TEST(std::string::npos != s.find("+25.0%  REGRESSION\n"));
+    BOOST_TEST(std::string::npos != s.find("+5.0%\n"));
+    BOOST_TEST(std::string::npos != s.find("-50.0%\n"));
+    BOOST_TEST(std::string::npos != s.find("new\n"));
+
+    // Any slowdown is a regression if none is tolerated.
+    BOOST_TEST_EQUAL(2, compare_to_baseline(results, baseline, 0.0, oss));
+}
+
+int test_main(int, char*[])
+{
+    test_percentile();
+    test_summarize();
+    test_sampling();
+    test_round_trip();
+    test_comparison();
+
+    return EXIT_SUCCESS;
+}
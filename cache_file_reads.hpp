@@ -31,6 +31,7 @@
 #include <ctime>                        // time_t
 #include <map>
 #include <memory>                       // shared_ptr
+#include <mutex>
 #include <string>
 #include <utility>                      // make_pair()
 
@@ -53,7 +54,8 @@ namespace detail
 /// exist, so managing constness is better left to each client.
 ///
 /// Implemented as a simple Meyers singleton, with the expected
-/// dead-reference and threading issues.
+/// dead-reference issues. Retrieval is serialized, so that cells may
+/// be reconciled concurrently.
 
 template<typename T>
 class file_cache
@@ -69,6 +71,8 @@ class file_cache
 
     retrieved_type retrieve_or_reload(std::string const& filename)
         {
+        std::lock_guard<std::mutex> const lock(mutex_);
+
         // Throws if !exists(filename).
         std::time_t const write_time = fs::last_write_time(filename);
 
@@ -106,6 +110,7 @@ class file_cache
     };
 
     std::map<std::string,record> cache_;
+    std::mutex mutex_;
 };
 } // namespace detail
 
@@ -110,7 +110,12 @@ ce_product_name::ce_product_name(std::string const& s)
 
 ce_product_name& ce_product_name::operator=(std::string const& s)
 {
-    value_ = product_names()[ordinal(s)];
+    std::string const& z = product_names()[ordinal(s)];
+    if(z != value_)
+        {
+        value_ = z;
+        note_change();
+        }
     return *this;
 }
 
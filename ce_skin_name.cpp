@@ -105,7 +105,12 @@ ce_skin_name::ce_skin_name(std::string const& s)
 
 ce_skin_name& ce_skin_name::operator=(std::string const& s)
 {
-    value_ = skin_names()[ordinal(s)];
+    std::string const& z = skin_names()[ordinal(s)];
+    if(z != value_)
+        {
+        value_ = z;
+        note_change();
+        }
     return *this;
 }
 
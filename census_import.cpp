@@ -0,0 +1,333 @@
+// Import a census from tab-delimited text.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+
+#include "pchfile.hpp"
+
+#include "census_import.hpp"
+
+#include "alert.hpp"
+#include "any_member.hpp"               // exact_cast()
+#include "assert_lmi.hpp"
+#include "calendar_date.hpp"
+#include "contains.hpp"
+#include "fenv_lmi.hpp"
+#include "input.hpp"
+#include "ssize_lmi.hpp"
+#include "value_cast.hpp"
+
+#include <algorithm>                    // count(), max(), min()
+#include <future>
+#include <string_view>
+#include <thread>
+#include <utility>                      // move()
+
+namespace
+{
+/// Skip whitespace other than tabs, as std::ws would with
+/// tab_is_not_whitespace_locale(); return the new position.
+
+std::string_view::size_type skip_space
+    (std::string_view            s
+    ,std::string_view::size_type i
+    )
+{
+    std::string_view::size_type const j = s.find_first_not_of(" \n\v\f\r", i);
+    return std::string_view::npos == j ? s.size() : j;
+}
+
+/// Extract a line as std::getline() would, and advance the position
+/// past its terminating newline, if any.
+
+std::string_view next_line
+    (std::string_view             s
+    ,std::string_view::size_type& i
+    )
+{
+    std::string_view::size_type const j = std::min(s.find('\n', i), s.size());
+    std::string_view const z = s.substr(i, j - i);
+    i = std::min(1 + j, s.size());
+    return z;
+}
+
+/// Split a line into fields, as std::getline() with a '\t' delimiter
+/// would: a final tab terminates the last field, rather than starting
+/// an empty one.
+
+std::vector<std::string_view> split_fields(std::string_view line)
+{
+    std::vector<std::string_view> z;
+    std::string_view::size_type i = 0;
+    while(i < line.size())
+        {
+        std::string_view::size_type const j = line.find('\t', i);
+        if(std::string_view::npos == j)
+            {
+            z.push_back(line.substr(i));
+            break;
+            }
+        z.push_back(line.substr(i, j - i));
+        i = 1 + j;
+        }
+    return z;
+}
+
+struct census_row
+{
+    int                           line_number;
+    std::string_view              line;
+    std::vector<std::string_view> values;
+};
+
+/// Pasted dates may be either JDN or YYYYMMDD; return them as JDN.
+
+std::string jdn_from_pasted_date
+    (std::string const& value
+    ,std::string const& header
+    ,int                line_number
+    )
+{
+    static int const jdn_min = calendar_date::gregorian_epoch_jdn;
+    static int const jdn_max = calendar_date::last_yyyy_date_jdn;
+    static int const ymd_min = JdnToYmd(jdn_t(jdn_min)).value();
+    static int const ymd_max = JdnToYmd(jdn_t(jdn_max)).value();
+    int const z = value_cast<int>(value);
+    if(jdn_min <= z && z <= jdn_max)
+        {
+        return value;
+        }
+    else if(ymd_min <= z && z <= ymd_max)
+        {
+        return value_cast<std::string>(YmdToJdn(ymd_t(z)).value());
+        }
+    else
+        {
+        alarum()
+            << "Invalid date " << value
+            << " for '" << header << "'"
+            << " on line " << line_number << "."
+            << LMI_FLUSH
+            ;
+        throw "Unreachable--silences a compiler diagnostic.";
+        }
+}
+
+/// Headers, and whether each names a date, are ascertained only once.
+
+struct census_columns
+{
+    std::vector<std::string> headers;
+    std::vector<bool>        is_date;
+};
+
+/// Modify a copy of the archetype to reflect one row; reconcile it.
+
+void apply_row
+    (census_columns const& columns
+    ,census_row const&     row
+    ,Input&                cell
+    )
+{
+    if(row.values.size() != columns.headers.size())
+        {
+        alarum()
+            << "Line #" << row.line_number << ": "
+            << "  (" << row.line << ") "
+            << "should have one value per column. "
+            << "Number of values: " << row.values.size() << "; "
+            << "number expected: " << columns.headers.size() << "."
+            << LMI_FLUSH
+            ;
+        }
+
+    for(int j = 0; j < lmi::ssize(columns.headers); ++j)
+        {
+        std::string const value(row.values[j]);
+        cell[columns.headers[j]] =
+            columns.is_date[j]
+            ? jdn_from_pasted_date(value, columns.headers[j], row.line_number)
+            : value
+            ;
+        }
+    cell.Reconcile();
+    cell.RealizeAllSequenceInput();
+}
+} // Unnamed namespace.
+
+/// Create cells from tab-delimited census data.
+///
+/// The first line names the Input members given in each column; each
+/// subsequent line represents one cell. Each cell is a copy of the
+/// archetype, modified by the values in its line, then reconciled
+/// and validated. Dates may be given either as JDN or as YYYYMMDD.
+/// Blank lines, and whitespace (other than tabs) at the beginning of
+/// a line, are ignored.
+///
+/// The archetype's 'UseDOB' is set according to whether age or date
+/// of birth is given. Pasting 'UseDOB' as a column never makes sense,
+/// so it draws a warning. Giving both age and date of birth is an
+/// error.
+///
+/// If there is no header line, or no cell, then a warning is given
+/// and an empty vector is returned.
+///
+/// Text is tokenized in place, and headers are validated only once,
+/// before any cell is created. Iff 'concurrently' is true, cells are
+/// reconciled on as many threads as the hardware supports; the cells
+/// are the same either way, but alerts raised on any thread other
+/// than the caller's are shown on that thread, so callers whose alert
+/// functions aren't thread safe must pass false. When rows contain
+/// errors, the error reported is the one that the first offending row
+/// engenders, regardless of concurrency. Progress is reported through
+/// status(), always on the caller's thread: after each cell when run
+/// serially, else after each thread's share of cells.
+
+std::vector<Input> cells_from_tab_delimited
+    (std::string const& census_data
+    ,Input&             archetype
+    ,bool               concurrently
+    )
+{
+    std::string_view const data(census_data);
+    std::string_view::size_type i = 0;
+
+    if(data.empty())
+        {
+        warning() << "Error pasting census data: no header line." << LMI_FLUSH;
+        return {};
+        }
+
+    census_columns columns;
+    for(auto const& j : split_fields(next_line(data, i)))
+        {
+        columns.headers.emplace_back(j);
+        }
+    i = skip_space(data, i);
+
+    // Validate headers: operator[]() throws if no such member exists.
+    for(auto const& j : columns.headers)
+        {
+        columns.is_date.push_back(nullptr != exact_cast<tnr_date>(archetype[j]));
+        }
+
+    // Force 'UseDOB' prn. Pasting it as a column never makes sense.
+    if(contains(columns.headers, "UseDOB"))
+        {
+        warning() << "'UseDOB' is unnecessary and will be ignored." << std::flush;
+        }
+    bool const dob_pasted = contains(columns.headers, "DateOfBirth");
+    bool const age_pasted = contains(columns.headers, "IssueAge");
+    if(dob_pasted && age_pasted)
+        {
+        alarum()
+            << "Cannot paste both 'DateOfBirth' and 'IssueAge'."
+            << LMI_FLUSH
+            ;
+        }
+    else if(dob_pasted)
+        {
+        archetype["UseDOB"] = "Yes";
+        }
+    else if(age_pasted)
+        {
+        archetype["UseDOB"] = "No";
+        }
+    else
+        {
+        ; // Do nothing: neither age nor DOB pasted.
+        }
+
+    std::vector<census_row> rows;
+    rows.reserve(std::count(data.begin(), data.end(), '\n'));
+    int current_line = 0;
+    while(i < data.size())
+        {
+        census_row r {++current_line, next_line(data, i), {}};
+        i = skip_space(data, i);
+        r.values = split_fields(r.line);
+        rows.push_back(std::move(r));
+        }
+
+    if(rows.empty())
+        {
+        warning() << "No cells to paste." << LMI_FLUSH;
+        return {};
+        }
+
+    int const n_threads =
+        concurrently
+        ? std::min
+            (lmi::ssize(rows)
+            ,std::max(1, static_cast<int>(std::thread::hardware_concurrency()))
+            )
+        : 1
+        ;
+    // Every cell is copied from the archetype here, and then modified
+    // in place, so that no Input need be copied again to gather the
+    // results. (Input has no move constructor, so moving would copy.)
+    std::vector<Input> cells(rows.size(), archetype);
+    if(1 == n_threads)
+        {
+        for(int j = 0; j < lmi::ssize(rows); ++j)
+            {
+            apply_row(columns, rows[j], cells[j]);
+            status() << "Added cell number " << 1 + j << '.' << std::flush;
+            }
+        return cells;
+        }
+
+    // Floating-point control words are thread-specific, so each
+    // thread sets its own. Each thread modifies only its own cells.
+    std::vector<std::future<void>> chunks;
+    for(int j = 0; j < n_threads; ++j)
+        {
+        int const first = j       * lmi::ssize(rows) / n_threads;
+        int const last  = (1 + j) * lmi::ssize(rows) / n_threads;
+        chunks.push_back
+            (std::async
+                (std::launch::async
+                ,[&rows, &columns, &cells, first, last]()
+                    {
+                    fenv_initialize();
+                    for(int k = first; k < last; ++k)
+                        {
+                        apply_row(columns, rows[k], cells[k]);
+                        }
+                    }
+                )
+            );
+        }
+
+    // Progress is reported only on the caller's thread. Chunks are
+    // joined in order, and each stops at its first offending row, so
+    // any exception rethrown here is the first offending row's.
+    for(int j = 0; j < n_threads; ++j)
+        {
+        chunks[j].get();
+        status()
+            << "Added cell number "
+            << (1 + j) * lmi::ssize(rows) / n_threads
+            << '.'
+            << std::flush
+            ;
+        }
+    return cells;
+}
@@ -27,11 +27,10 @@
 #include "assert_lmi.hpp"
 #include "bourn_cast.hpp"
 #include "census_document.hpp"
+#include "census_import.hpp"
 #include "configurable_settings.hpp"
-#include "contains.hpp"
 #include "default_view.hpp"
 #include "edit_mvc_docview_parameters.hpp"
-#include "facets.hpp"                   // tab_is_not_whitespace_locale()
 #include "global_settings.hpp"
 #include "illustration_view.hpp"
 #include "illustrator.hpp"
@@ -68,7 +67,6 @@
 #include <algorithm>
 #include <cctype>                       // isupper()
 #include <fstream>
-#include <istream>                      // ws
 #include <iterator>                     // insert_iterator
 #include <sstream>
 
@@ -732,10 +730,12 @@ void CensusViewGridTable::SetValue(int row, int col, wxString const& value)
         return;
         }
 
-    cell = new_val;
-
     Input& model = view_.cell_parms().at(row);
+    {
+    member_tally<Input>::change const c(view_.cell_tally_, model);
+    cell = new_val;
     model.Reconcile();
+    }
 
     view_.document().Modify(true);
 }
@@ -1072,13 +1072,22 @@ Input* CensusView::class_parms_from_class_name(std::string const& class_name)
 /// Determine which columns need to be displayed because their rows
 /// would not all be identical--i.e. because at least one cell or one
 /// class default differs from the case default wrt that column.
+///
+/// Class defaults are few, so they're compared directly. Cells may be
+/// many, so their values are tallied instead; the tally is kept up to
+/// date as cells are added, deleted, or edited, and rebuilt here only
+/// after wholesale changes.
 
-bool CensusView::column_value_varies_across_cells(std::string const& header) const
+bool CensusView::column_value_varies_across_cells(int column) const
 {
+    if(!cell_tally_.is_valid())
+        {
+        cell_tally_.rebuild(cell_parms().begin(), cell_parms().end());
+        }
+    std::string const& header = case_parms()[0].member_names()[column];
     auto const z = case_parms()[0][header];
     for(auto const& j : class_parms()) {if(z != j[header]) return true;}
-    for(auto const& j : cell_parms() ) {if(z != j[header]) return true;}
-    return false;
+    return cell_tally_.varies_from(column, z.str());
 }
 
 wxWindow* CensusView::CreateChildWindow()
@@ -1239,6 +1248,9 @@ void CensusView::apply_changes
     //   if case  defaults changed: all cells and all class defaults;
     //   if class defaults changed: all cells in the class.
 
+    // Any number of cells may change.
+    cell_tally_.invalidate();
+
     std::vector<std::string> headers_of_changed_parameters;
     std::vector<std::string> const& all_headers(case_parms()[0].member_names());
     for(auto const& i : all_headers)
@@ -1296,14 +1308,12 @@ void CensusView::update_visible_columns()
     // wrt some column, we respect that conscious decision.
     std::vector<std::string> const& all_headers(case_parms()[0].member_names());
     std::vector<int> new_visible_columns;
-    int column = 0;
-    for(auto const& header : all_headers)
+    for(int column = 0; column < lmi::ssize(all_headers); ++column)
         {
-        if(column_value_varies_across_cells(header))
+        if(column_value_varies_across_cells(column))
             {
             new_visible_columns.push_back(column);
             }
-        ++column;
         }
 
     if(new_visible_columns != grid_table_->get_visible_columns())
@@ -1359,7 +1369,12 @@ void CensusView::UponEditCell(wxCommandEvent&)
     Input& modifiable_parms = cell_parms()[cell_number];
     std::string const title = cell_title(cell_number);
 
-    if(oe_mvc_dv_changed == edit_parameters(modifiable_parms, title))
+    oenum_mvc_dv_rc rc;
+    {
+    member_tally<Input>::change const c(cell_tally_, modifiable_parms);
+    rc = edit_parameters(modifiable_parms, title);
+    }
+    if(oe_mvc_dv_changed == rc)
         {
         Update();
         document().Modify(true);
@@ -1605,6 +1620,7 @@ void CensusView::UponAddCell(wxCommandEvent&)
     Timer timer;
 
     cell_parms().push_back(case_parms()[0]);
+    cell_tally_.add(cell_parms().back());
     grid_window_->AppendRows();
 
     Update();
@@ -1699,6 +1715,10 @@ void CensusView::UponDeleteCells(wxCommandEvent&)
         auto const count = block.GetBottomRow() - block.GetTopRow() + 1;
 
         auto const first = cell_parms().begin() + block.GetTopRow();
+        for(auto j = first; j != first + count; ++j)
+            {
+            cell_tally_.remove(*j);
+            }
         cell_parms().erase(first, first + count);
         grid_window_->DeleteRows(block.GetTopRow(), count);
         }
@@ -1758,142 +1778,27 @@ void CensusView::UponPasteCensus(wxCommandEvent&)
 {
     std::string const census_data = ClipboardEx::GetText();
 
-    std::vector<std::string> headers;
-    std::vector<Input> cells;
-
-    std::istringstream iss_census(census_data);
-    iss_census.imbue(tab_is_not_whitespace_locale());
-    std::string line;
-
-    // Get header line; parse into field names.
-    if(std::getline(iss_census, line, '\n'))
-        {
-        iss_census >> std::ws;
-
-        std::istringstream iss_line(line);
-        std::string token;
-
-        while(std::getline(iss_line, token, '\t'))
-            {
-            headers.push_back(token);
-            }
-        }
-    else
-        {
-        warning() << "Error pasting census data: no header line." << LMI_FLUSH;
-        return;
-        }
-
     // Use a modifiable copy of case defaults as an archetype for new
     // cells to be created by pasting. Modifications are conditionally
     // written back to case defaults later.
     Input archetype(case_parms()[0]);
 
-    // Force 'UseDOB' prn. Pasting it as a column never makes sense.
-    if(contains(headers, "UseDOB"))
-        {
-        warning() << "'UseDOB' is unnecessary and will be ignored." << std::flush;
-        }
-    bool const dob_pasted = contains(headers, "DateOfBirth");
-    bool const age_pasted = contains(headers, "IssueAge");
-    if(dob_pasted && age_pasted)
-        {
-        alarum()
-            << "Cannot paste both 'DateOfBirth' and 'IssueAge'."
-            << LMI_FLUSH
-            ;
-        }
-    else if(dob_pasted)
-        {
-        archetype["UseDOB"] = "Yes";
-        }
-    else if(age_pasted)
-        {
-        archetype["UseDOB"] = "No";
-        }
-    else
-        {
-        ; // Do nothing: neither age nor DOB pasted.
-        }
-
-    cells.reserve(std::count(census_data.begin(), census_data.end(), '\n'));
-
-    // Read each subsequent line into an input object representing one cell.
-    int current_line = 0;
-    while(std::getline(iss_census, line, '\n'))
-        {
-        ++current_line;
-
-        iss_census >> std::ws;
-
-        Input current_cell(archetype);
-
-        std::istringstream iss_line(line);
-        std::string token;
-        std::vector<std::string> values;
-
-        while(std::getline(iss_line, token, '\t'))
-            {
-            values.push_back(token);
-            }
-
-        if(values.size() != headers.size())
-            {
-            alarum()
-                << "Line #" << current_line << ": "
-                << "  (" << line << ") "
-                << "should have one value per column. "
-                << "Number of values: " << values.size() << "; "
-                << "number expected: " << headers.size() << "."
-                << LMI_FLUSH
-                ;
-            }
-
-        for(int j = 0; j < lmi::ssize(headers); ++j)
-            {
-            if(exact_cast<tnr_date>(current_cell[headers[j]]))
-                {
-                static int const jdn_min = calendar_date::gregorian_epoch_jdn;
-                static int const jdn_max = calendar_date::last_yyyy_date_jdn;
-                static int const ymd_min = JdnToYmd(jdn_t(jdn_min)).value();
-                static int const ymd_max = JdnToYmd(jdn_t(jdn_max)).value();
-                int z = value_cast<int>(values[j]);
-                if(jdn_min <= z && z <= jdn_max)
-                    {
-                    ; // Do nothing: JDN is the default expectation.
-                    }
-                else if(ymd_min <= z && z <= ymd_max)
-                    {
-                    z = YmdToJdn(ymd_t(z)).value();
-                    values[j] = value_cast<std::string>(z);
-                    }
-                else
-                    {
-                    alarum()
-                        << "Invalid date " << values[j]
-                        << " for '" << headers[j] << "'"
-                        << " on line " << current_line << "."
-                        << LMI_FLUSH
-                        ;
-                    }
-                }
-            current_cell[headers[j]] = values[j];
-            }
-        current_cell.Reconcile();
-        current_cell.RealizeAllSequenceInput();
-        cells.push_back(current_cell);
-
-        status() << "Added cell number " << cells.size() << '.' << std::flush;
-        }
-
-    if(0 == current_line)
+    // Cells are reconciled serially here, because alerts are shown by
+    // wx functions, which mustn't be called from other threads.
+    std::vector<Input> cells = cells_from_tab_delimited
+        (census_data
+        ,archetype
+        ,false
+        );
+    if(cells.empty())
         {
-        warning() << "No cells to paste." << LMI_FLUSH;
         return;
         }
 
     auto const old_rows = grid_table_->GetNumberRows();
 
+    cell_tally_.invalidate();
+
     if(!document().IsModified() && !document().GetDocumentSaved())
         {
         case_parms ().clear();
@@ -1982,9 +1887,10 @@ void CensusView::DoCopyCensus() const
     Timer timer;
     std::vector<std::string> distinct_headers;
     std::vector<std::string> const& all_headers(case_parms()[0].member_names());
-    for(auto const& header : all_headers)
+    for(int column = 0; column < lmi::ssize(all_headers); ++column)
         {
-        bool const varies = column_value_varies_across_cells(header);
+        std::string const& header = all_headers[column];
+        bool const varies = column_value_varies_across_cells(column);
         if(header != "UseDOB" && header != "IssueAge" && varies)
             {
             distinct_headers.push_back(header);
@@ -28,6 +28,7 @@
 
 #include "input.hpp"
 #include "ledger.hpp"
+#include "member_tally.hpp"
 #include "mc_enum_type_enums.hpp"       // enum mcenum_emission
 #include "oecumenic_enumerations.hpp"
 
@@ -115,7 +116,7 @@ class CensusView final
     std::string class_name_from_cell_number(int) const;
     Input* class_parms_from_class_name(std::string const&);
 
-    bool column_value_varies_across_cells(std::string const& header) const;
+    bool column_value_varies_across_cells(int column) const;
 
     oenum_mvc_dv_rc edit_parameters
         (Input&             parameters
@@ -132,6 +133,9 @@ class CensusView final
 
     std::shared_ptr<Ledger const> composite_ledger_;
 
+    // Rebuilt on demand after cells change wholesale.
+    mutable member_tally<Input> cell_tally_;
+
     wxGrid*              grid_window_ {nullptr};
     CensusViewGridTable* grid_table_  {nullptr};
 
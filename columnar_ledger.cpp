@@ -0,0 +1,287 @@
+// Columnar binary ledger files.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#include "pchfile.hpp"
+
+#include "columnar_ledger.hpp"
+
+#include "alert.hpp"
+#include "assert_lmi.hpp"
+#include "bourn_cast.hpp"
+#include "ssize_lmi.hpp"
+
+#include <algorithm>                    // find(), min()
+#include <cstdint>
+#include <cstring>                      // memcmp(), memcpy()
+#include <ostream>
+
+namespace
+{
+char const magic[8] = {'l', 'm', 'i', 'c', 'o', 'l', '1', '\0'};
+
+std::uint32_t const byte_order_mark = 0x01020304;
+
+/// Size of the fixed part of the file, preceding the schema.
+
+std::size_t const preamble_size = 24;
+
+/// Round up to a multiple of eight bytes.
+
+std::size_t padded(std::size_t n)
+{
+    return (n + 7) & ~std::size_t(7);
+}
+
+template<typename T>
+void write_raw(std::ostream& os, T const& t)
+{
+    os.write(reinterpret_cast<char const*>(&t), sizeof t);
+}
+
+template<typename T>
+T read_raw(char const* p)
+{
+    T t;
+    std::memcpy(&t, p, sizeof t);
+    return t;
+}
+} // Unnamed namespace.
+
+columnar_ledger_writer::columnar_ledger_writer(std::ostream& os)
+    :os_ {os}
+{
+}
+
+/// Append one cell's vectors as a block.
+///
+/// The first block's columns determine the schema, which is written
+/// then; every later block must have the same columns, in the same
+/// order. Each column has 'length' rows: a longer vector is
+/// truncated, and a shorter one padded with zeros, so that every
+/// column of a block has the same length.
+
+void columnar_ledger_writer::append
+    (std::vector<columnar_ledger_column> const& columns
+    ,int                                        length
+    ,bool                                       is_composite
+    )
+{
+    LMI_ASSERT(!columns.empty());
+    LMI_ASSERT(0 <= length);
+    if(names_.empty())
+        {
+        write_schema(columns);
+        }
+    else
+        {
+        LMI_ASSERT(lmi::ssize(names_) == lmi::ssize(columns));
+        for(int j = 0; j < lmi::ssize(columns); ++j)
+            {
+            if(names_[j] != columns[j].name)
+                {
+                alarum()
+                    << "Columnar ledger column '"
+                    << columns[j].name
+                    << "' should be '"
+                    << names_[j]
+                    << "'."
+                    << LMI_FLUSH
+                    ;
+                }
+            }
+        }
+
+    write_raw(os_, bourn_cast<std::int32_t>(length));
+    write_raw(os_, bourn_cast<std::int32_t>(is_composite));
+    for(auto const& i : columns)
+        {
+        LMI_ASSERT(nullptr != i.values);
+        int const n = std::min(length, lmi::ssize(*i.values));
+        os_.write
+            (reinterpret_cast<char const*>(i.values->data())
+            ,n * static_cast<std::streamsize>(sizeof(double))
+            );
+        for(int j = n; j < length; ++j)
+            {
+            write_raw(os_, 0.0);
+            }
+        }
+}
+
+void columnar_ledger_writer::write_schema
+    (std::vector<columnar_ledger_column> const& columns
+    )
+{
+    std::string schema;
+    for(auto const& i : columns)
+        {
+        LMI_ASSERT(std::string::npos == i.name  .find_first_of("\t\n"));
+        LMI_ASSERT(std::string::npos == i.legend.find_first_of("\t\n"));
+        LMI_ASSERT(!i.name.empty());
+        schema += i.name + '\t' + i.legend + '\n';
+        names_.push_back(i.name);
+        }
+    schema.resize(padded(schema.size()), '\0');
+
+    os_.write(magic, sizeof magic);
+    write_raw(os_, byte_order_mark);
+    write_raw(os_, bourn_cast<std::uint32_t>(columns.size()));
+    write_raw(os_, bourn_cast<std::uint64_t>(schema.size()));
+    os_.write(schema.data(), bourn_cast<std::streamsize>(schema.size()));
+}
+
+/// Map a columnar ledger file and index its blocks.
+///
+/// Only the schema and the block headers are read here; values are
+/// read from disk only when they're first used.
+
+columnar_ledger_reader::columnar_ledger_reader(fs::path const& filepath)
+    :file_ {filepath}
+{
+    char const* const p    = file_.data();
+    std::size_t const size = file_.size();
+
+    if
+        (  size < preamble_size
+        || 0 != std::memcmp(p, magic, sizeof magic)
+        )
+        {
+        alarum()
+            << "File '"
+            << filepath.string()
+            << "' is not a columnar ledger file."
+            << LMI_FLUSH
+            ;
+        }
+    if(byte_order_mark != read_raw<std::uint32_t>(p + 8))
+        {
+        alarum()
+            << "File '"
+            << filepath.string()
+            << "' was written with a different byte order."
+            << LMI_FLUSH
+            ;
+        }
+    std::size_t const n_columns   = read_raw<std::uint32_t>(p + 12);
+    std::size_t const schema_size = bourn_cast<std::size_t>
+        (read_raw<std::uint64_t>(p + 16)
+        );
+    if(size - preamble_size < schema_size || 0 != schema_size % 8)
+        {
+        alarum() << "File '" << filepath.string() << "' is truncated." << LMI_FLUSH;
+        }
+
+    // Parse "name\tlegend\n" lines, ignoring the padding that follows.
+    std::string const schema(p + preamble_size, schema_size);
+    std::string::size_type line = 0;
+    for(;;)
+        {
+        std::string::size_type const eol = schema.find('\n', line);
+        if(std::string::npos == eol)
+            {
+            break;
+            }
+        std::string::size_type const tab = schema.find('\t', line);
+        LMI_ASSERT(tab < eol);
+        names_  .push_back(schema.substr(line, tab - line));
+        legends_.push_back(schema.substr(1 + tab, eol - tab - 1));
+        line = 1 + eol;
+        }
+    if(n_columns != names_.size())
+        {
+        alarum()
+            << "File '"
+            << filepath.string()
+            << "' has "
+            << names_.size()
+            << " columns in its schema, but should have "
+            << n_columns
+            << "."
+            << LMI_FLUSH
+            ;
+        }
+
+    std::size_t offset = preamble_size + schema_size;
+    while(offset < size)
+        {
+        if(size - offset < 8)
+            {
+            alarum() << "File '" << filepath.string() << "' is truncated." << LMI_FLUSH;
+            }
+        std::int32_t const length = read_raw<std::int32_t>(p + offset);
+        std::int32_t const flags  = read_raw<std::int32_t>(p + offset + 4);
+        LMI_ASSERT(0 <= length);
+        offset += 8;
+        std::size_t const bytes =
+            n_columns * bourn_cast<std::size_t>(length) * sizeof(double);
+        if(size - offset < bytes)
+            {
+            alarum() << "File '" << filepath.string() << "' is truncated." << LMI_FLUSH;
+            }
+        blocks_.push_back({offset, length, 1 == flags});
+        offset += bytes;
+        }
+}
+
+/// Index of the named column.
+
+int columnar_ledger_reader::column_index(std::string const& name) const
+{
+    auto const i = std::find(names_.begin(), names_.end(), name);
+    if(names_.end() == i)
+        {
+        alarum() << "Column '" << name << "' not found." << LMI_FLUSH;
+        }
+    return bourn_cast<int>(i - names_.begin());
+}
+
+int columnar_ledger_reader::cells() const
+{
+    return lmi::ssize(blocks_);
+}
+
+int columnar_ledger_reader::length(int cell) const
+{
+    LMI_ASSERT(0 <= cell && cell < cells());
+    return blocks_[cell].length;
+}
+
+bool columnar_ledger_reader::is_composite(int cell) const
+{
+    LMI_ASSERT(0 <= cell && cell < cells());
+    return blocks_[cell].is_composite;
+}
+
+/// Values of one column of one cell, in place in the mapped file.
+///
+/// The pointer is valid for the lifetime of this object, and points
+/// to length(cell) values.
+
+double const* columnar_ledger_reader::column(int cell, int column) const
+{
+    LMI_ASSERT(0 <= cell && cell < cells());
+    LMI_ASSERT(0 <= column && column < lmi::ssize(names_));
+    block const& b = blocks_[cell];
+    return
+          reinterpret_cast<double const*>(file_.data() + b.offset)
+        + column * b.length
+        ;
+}
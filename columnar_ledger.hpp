@@ -0,0 +1,124 @@
+// Columnar binary ledger files.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#ifndef columnar_ledger_hpp
+#define columnar_ledger_hpp
+
+#include "config.hpp"
+
+#include "mapped_file.hpp"
+#include "so_attributes.hpp"
+
+#include <boost/filesystem/path.hpp>
+
+#include <cstddef>                      // size_t
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// Design notes for columnar ledger files.
+///
+/// A columnar ledger file holds the numeric vectors of any number of
+/// ledgers, for analysis by other programs that would rather not
+/// parse text. Its layout is:
+///
+///   magic number      8 bytes: "lmicol1" and a null terminator
+///   byte-order mark   uint32: 0x01020304 as written
+///   column count      uint32
+///   schema size       uint64: a multiple of eight
+///   schema            "name\tlegend\n" for each column, null-padded
+///   cells             any number of blocks, each comprising:
+///     length          int32: number of rows (policy years)
+///     flags           int32: 1 for a composite, else 0
+///     values          double[columns][length], column by column
+///
+/// Numbers are written in the host's native representation; the
+/// byte-order mark lets a reader detect a file written on a machine
+/// of the other endianness, which it rejects rather than converts.
+///
+/// Each block is written as soon as its cell is emitted, so a case
+/// needn't be held in memory. Every field is a multiple of eight
+/// bytes from the start of the file, so the values of a mapped file
+/// are aligned and can be used in place, without copying.
+
+struct columnar_ledger_column
+{
+    std::string                name;
+    std::string                legend;
+    std::vector<double> const* values;
+};
+
+class LMI_SO columnar_ledger_writer final
+{
+  public:
+    explicit columnar_ledger_writer(std::ostream&);
+    ~columnar_ledger_writer() = default;
+
+    void append
+        (std::vector<columnar_ledger_column> const& columns
+        ,int                                        length
+        ,bool                                       is_composite
+        );
+
+  private:
+    columnar_ledger_writer(columnar_ledger_writer const&) = delete;
+    columnar_ledger_writer& operator=(columnar_ledger_writer const&) = delete;
+
+    void write_schema(std::vector<columnar_ledger_column> const&);
+
+    std::ostream&            os_;
+    std::vector<std::string> names_;
+};
+
+class LMI_SO columnar_ledger_reader final
+{
+  public:
+    explicit columnar_ledger_reader(fs::path const&);
+    ~columnar_ledger_reader() = default;
+
+    std::vector<std::string> const& names  () const {return names_;  }
+    std::vector<std::string> const& legends() const {return legends_;}
+
+    int column_index(std::string const& name) const;
+
+    int           cells       ()                     const;
+    int           length      (int cell)             const;
+    bool          is_composite(int cell)             const;
+    double const* column      (int cell, int column) const;
+
+  private:
+    columnar_ledger_reader(columnar_ledger_reader const&) = delete;
+    columnar_ledger_reader& operator=(columnar_ledger_reader const&) = delete;
+
+    struct block
+    {
+        std::size_t offset;
+        int         length;
+        bool        is_composite;
+    };
+
+    mapped_file              file_;
+    std::vector<std::string> names_;
+    std::vector<std::string> legends_;
+    std::vector<block>       blocks_;
+};
+
+#endif // columnar_ledger_hpp
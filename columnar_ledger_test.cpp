@@ -0,0 +1,156 @@
+// Columnar binary ledger files--unit test.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#include "pchfile.hpp"
+
+#include "columnar_ledger.hpp"
+
+#include "miscellany.hpp"               // ios_out_trunc_binary()
+#include "test_tools.hpp"
+
+#include <cstdio>                       // remove()
+#include <fstream>
+#include <iterator>                     // istreambuf_iterator
+#include <stdexcept>
+
+namespace
+{
+char const* const filename = "eraseme.columnar";
+
+std::vector<double> const age  {45.0, 46.0, 47.0};
+std::vector<double> const av   {1000.0, 2000.5, -3.25};
+std::vector<double> const lives{1.0, 0.99, 0.98, 0.97};
+std::vector<double> const none {};
+} // Unnamed namespace.
+
+void test_round_trip()
+{
+    {
+    std::ofstream ofs(filename, ios_out_trunc_binary());
+    columnar_ledger_writer w(ofs);
+    // Legends are optional. A column may be shorter or longer than
+    // the block, which is padded or truncated accordingly.
+    w.append
+        ({{"Age"       , "Issue Age"    , &age  }
+         ,{"AcctVal"   , ""             , &av   }
+         ,{"Lives"     , "Inforce Lives", &lives}
+         }
+        ,3
+        ,false
+        );
+    w.append
+        ({{"Age"       , "Issue Age"    , &age  }
+         ,{"AcctVal"   , ""             , &none }
+         ,{"Lives"     , "Inforce Lives", &lives}
+         }
+        ,2
+        ,true
+        );
+    BOOST_TEST_THROW
+        (w.append({{"Age", "", &age}, {"AV", "", &av}, {"Lives", "", &lives}}, 3, false)
+        ,std::runtime_error
+        ,"Columnar ledger column 'AV' should be 'AcctVal'."
+        );
+    }
+
+    columnar_ledger_reader r(filename);
+    BOOST_TEST_EQUAL(3            , r.names().size());
+    BOOST_TEST_EQUAL("AcctVal"    , r.names()[1]);
+    BOOST_TEST_EQUAL("Issue Age"  , r.legends()[0]);
+    BOOST_TEST_EQUAL(""           , r.legends()[1]);
+    BOOST_TEST_EQUAL(2            , r.column_index("Lives"));
+    BOOST_TEST_THROW
+        (r.column_index("NoSuchColumn")
+        ,std::runtime_error
+        ,"Column 'NoSuchColumn' not found."
+        );
+
+    // The failed append above wrote nothing.
+    BOOST_TEST_EQUAL(2    , r.cells());
+    BOOST_TEST_EQUAL(3    , r.length(0));
+    BOOST_TEST_EQUAL(false, r.is_composite(0));
+    BOOST_TEST_EQUAL(2    , r.length(1));
+    BOOST_TEST_EQUAL(true , r.is_composite(1));
+
+    double const* a = r.column(0, r.column_index("AcctVal"));
+    BOOST_TEST_EQUAL( 1000.0 , a[0]);
+    BOOST_TEST_EQUAL( 2000.5 , a[1]);
+    BOOST_TEST_EQUAL(   -3.25, a[2]);
+    double const* l = r.column(0, 2);
+    BOOST_TEST_EQUAL(0.98, l[2]);
+    a = r.column(1, 1);
+    BOOST_TEST_EQUAL(0.0 , a[0]);
+    BOOST_TEST_EQUAL(0.0 , a[1]);
+    l = r.column(1, 2);
+    BOOST_TEST_EQUAL(0.99, l[1]);
+
+    BOOST_TEST_THROW
+        (r.column(2, 0)
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Assertion.*failed")
+        );
+
+    BOOST_TEST(0 == std::remove(filename));
+}
+
+void test_invalid_files()
+{
+    {
+    std::ofstream ofs(filename, ios_out_trunc_binary());
+    ofs << "Not a columnar ledger file, but long enough to be one.";
+    }
+    BOOST_TEST_THROW
+        (columnar_ledger_reader r(filename)
+        ,std::runtime_error
+        ,"File 'eraseme.columnar' is not a columnar ledger file."
+        );
+
+    // A file whose last block is incomplete, as if writing it had
+    // been interrupted, is rejected.
+    {
+    std::ofstream ofs(filename, ios_out_trunc_binary());
+    columnar_ledger_writer w(ofs);
+    w.append({{"Age", "", &age}}, 3, false);
+    w.append({{"Age", "", &age}}, 3, false);
+    }
+    {
+    std::ifstream ifs(filename, std::ios_base::in | std::ios_base::binary);
+    std::string const s {std::istreambuf_iterator<char>(ifs), {}};
+    ifs.close();
+    std::ofstream ofs(filename, ios_out_trunc_binary());
+    ofs.write(s.data(), static_cast<std::streamsize>(s.size() - 1));
+    }
+    BOOST_TEST_THROW
+        (columnar_ledger_reader r(filename)
+        ,std::runtime_error
+        ,"File 'eraseme.columnar' is truncated."
+        );
+
+    BOOST_TEST(0 == std::remove(filename));
+}
+
+int test_main(int, char*[])
+{
+    test_round_trip();
+    test_invalid_files();
+
+    return EXIT_SUCCESS;
+}
@@ -23,9 +23,25 @@
 
 #include "datum_base.hpp"
 
+#include <atomic>
 #include <istream>
 #include <ostream>
 
+namespace
+{
+/// Data in different Models may be changed concurrently, e.g. when
+/// census cells are imported in parallel.
+
+std::atomic<std::uint64_t> revision_counter {0};
+} // Unnamed namespace.
+
+datum_base& datum_base::operator=(datum_base const& z)
+{
+    enabled_ = z.enabled_;
+    note_change();
+    return *this;
+}
+
 void datum_base::enable(bool b)
 {
     enabled_ = b;
@@ -36,6 +52,21 @@ bool datum_base::is_enabled() const
     return enabled_;
 }
 
+std::uint64_t datum_base::revision() const
+{
+    return revision_;
+}
+
+std::uint64_t datum_base::latest_revision()
+{
+    return revision_counter.load(std::memory_order_relaxed);
+}
+
+void datum_base::note_change()
+{
+    revision_ = 1 + revision_counter.fetch_add(1, std::memory_order_relaxed);
+}
+
 std::istream& operator>>(std::istream& is, datum_base& z)
 {
     return z.read(is);
@@ -26,24 +26,41 @@
 
 #include "so_attributes.hpp"
 
+#include <cstdint>                      // uint64_t
 #include <iosfwd>
 
-// Implicitly-declared special member functions do the right thing.
+/// Base class for MVC Model data.
+///
+/// Every change to a datum's value stamps it with a new revision,
+/// drawn from a counter shared by all data, so that whether a datum
+/// has changed since some moment can be determined by comparing its
+/// revision() to latest_revision() as of that moment. Derived classes
+/// call note_change() wherever they alter their value; copy assignment
+/// calls it unconditionally, because the base cannot compare values.
 
 class LMI_SO datum_base
 {
   public:
     datum_base() = default;
+    datum_base(datum_base const&) = default;
+    datum_base& operator=(datum_base const&);
     virtual ~datum_base() = default;
 
     void enable(bool);
     bool is_enabled() const;
 
+    std::uint64_t revision() const;
+    static std::uint64_t latest_revision();
+
     virtual std::istream& read (std::istream&)       = 0;
     virtual std::ostream& write(std::ostream&) const = 0;
 
+  protected:
+    void note_change();
+
   private:
     bool enabled_ {true};
+    std::uint64_t revision_ {0};
 };
 
 std::istream& operator>>(std::istream&, datum_base&);
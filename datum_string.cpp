@@ -35,7 +35,11 @@ datum_string::datum_string(std::string const& value)
 
 datum_string& datum_string::operator=(std::string const& s)
 {
-    value_ = s;
+    if(s != value_)
+        {
+        value_ = s;
+        note_change();
+        }
     return *this;
 }
 
@@ -49,6 +53,7 @@ std::istream& datum_string::read(std::istream& is)
     std::locale old_locale = is.imbue(blank_is_not_whitespace_locale());
     is >> value_;
     is.imbue(old_locale);
+    note_change();
     return is;
 }
 
@@ -39,6 +39,7 @@ class death_benefits final
         ,yare_input       const&
         ,round_to<double> const& round_specamt
         );
+    death_benefits(death_benefits const&) = default;
     ~death_benefits() = default;
 
     void set_specamt (double z, int from_year, int to_year);
@@ -49,7 +50,6 @@ class death_benefits final
     std::vector<double>       const& supplamt() const;
 
   private:
-    death_benefits(death_benefits const&) = delete;
     death_benefits& operator=(death_benefits const&) = delete;
 
     int length_;
@@ -23,7 +23,9 @@
 
 #include "emit_ledger.hpp"
 
+#include "alert.hpp"
 #include "assert_lmi.hpp"
+#include "columnar_ledger.hpp"
 #include "configurable_settings.hpp"
 #include "custom_io_0.hpp"
 #include "custom_io_1.hpp"
@@ -32,16 +34,60 @@
 #include "ledger.hpp"
 #include "ledger_pdf.hpp"
 #include "ledger_text_formats.hpp"
-#include "miscellany.hpp"               // ios_out_trunc_binary()
+#include "miscellany.hpp"               // ios_out_app_binary(), ios_out_trunc_binary()
 #include "path_utility.hpp"             // unique_filepath()
 #include "timer.hpp"
 
 #include <boost/filesystem/convenience.hpp> // change_extension()
 #include <boost/filesystem/fstream.hpp>
 
+#include <fstream>
 #include <iostream>
 #include <string>
 
+namespace
+{
+/// Open a case-level file for appending, unless it's already open.
+
+std::ofstream& case_file
+    (std::unique_ptr<std::ofstream>& ofs
+    ,fs::path const&                 filepath
+    )
+{
+    if(!ofs)
+        {
+        ofs = std::make_unique<std::ofstream>
+            (filepath.string().c_str()
+            ,ios_out_app_binary()
+            );
+        }
+    return *ofs;
+}
+
+void throw_if_unwritten(std::ofstream const& ofs, fs::path const& filepath)
+{
+    if(!ofs)
+        {
+        alarum() << "Unable to write '" << filepath.string() << "'." << LMI_FLUSH;
+        }
+}
+
+/// Close a case-level file, if it's open, so that it's complete.
+
+void close_case_file
+    (std::unique_ptr<std::ofstream>& ofs
+    ,fs::path const&                 filepath
+    )
+{
+    if(ofs)
+        {
+        ofs->close();
+        throw_if_unwritten(*ofs, filepath);
+        ofs.reset();
+        }
+}
+} // Unnamed namespace.
+
 /// Emit a group of ledgers in various guises.
 ///
 /// The ledgers constitute a 'case' consisting of 'cells' as those
@@ -73,6 +119,10 @@ ledger_emitter::ledger_emitter
         {
         case_filepath_group_quote_  = unique_filepath(f, ".quote.pdf"       );
         }
+    if(emission_ & mce_emit_columnar)
+        {
+        case_filepath_columnar_     = unique_filepath(f, ".columnar"        );
+        }
 }
 
 ledger_emitter::~ledger_emitter() = default;
@@ -85,7 +135,9 @@ double ledger_emitter::initiate()
 
     if(emission_ & mce_emit_group_roster)
         {
-        PrintRosterHeaders(case_filepath_group_roster_.string());
+        std::ofstream& os = case_file(group_roster_ofs_, case_filepath_group_roster_);
+        PrintRosterHeaders(os);
+        throw_if_unwritten(os, case_filepath_group_roster_);
         }
     if(emission_ & mce_emit_group_quote)
         {
@@ -132,16 +184,30 @@ double ledger_emitter::emit_cell
         }
     if(emission_ & mce_emit_spreadsheet)
         {
-        PrintCellTabDelimited(ledger, case_filepath_spreadsheet_.string());
+        std::ofstream& os = case_file(spreadsheet_ofs_, case_filepath_spreadsheet_);
+        PrintCellTabDelimited(ledger, os);
+        throw_if_unwritten(os, case_filepath_spreadsheet_);
         }
     if(emission_ & mce_emit_group_roster)
         {
-        PrintRosterTabDelimited(ledger, case_filepath_group_roster_.string());
+        std::ofstream& os = case_file(group_roster_ofs_, case_filepath_group_roster_);
+        PrintRosterTabDelimited(ledger, os);
+        throw_if_unwritten(os, case_filepath_group_roster_);
         }
     if(emission_ & mce_emit_group_quote)
         {
         group_quote_pdf_gen_->add_ledger(ledger);
         }
+    if(emission_ & mce_emit_columnar)
+        {
+        std::ofstream& os = case_file(columnar_ofs_, case_filepath_columnar_);
+        if(!columnar_writer_)
+            {
+            columnar_writer_ = std::make_unique<columnar_ledger_writer>(os);
+            }
+        PrintCellColumnar(ledger, *columnar_writer_);
+        throw_if_unwritten(os, case_filepath_columnar_);
+        }
     if(emission_ & mce_emit_text_stream)
         {
         PrintLedgerFlatText(ledger, std::cout);
@@ -177,6 +243,10 @@ double ledger_emitter::finish()
 {
     Timer timer;
 
+    close_case_file(spreadsheet_ofs_ , case_filepath_spreadsheet_ );
+    close_case_file(group_roster_ofs_, case_filepath_group_roster_);
+    columnar_writer_.reset();
+    close_case_file(columnar_ofs_    , case_filepath_columnar_    );
     if(emission_ & mce_emit_group_quote)
         {
         group_quote_pdf_gen_->save(case_filepath_group_quote_.string());
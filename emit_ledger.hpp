@@ -29,9 +29,11 @@
 
 #include <boost/filesystem/path.hpp>
 
+#include <iosfwd>                       // ofstream
 #include <memory>                       // unique_ptr
 
 class Ledger;
+class columnar_ledger_writer;
 class group_quote_pdf_generator;
 
 /// Emit a group of ledgers in various guises.
@@ -60,6 +62,16 @@ class LMI_SO ledger_emitter final
     fs::path case_filepath_spreadsheet_;
     fs::path case_filepath_group_roster_;
     fs::path case_filepath_group_quote_;
+    fs::path case_filepath_columnar_;
+
+    // Case-level files are opened once, when first needed, and kept
+    // open until finish() or destruction.
+    std::unique_ptr<std::ofstream> spreadsheet_ofs_;
+    std::unique_ptr<std::ofstream> group_roster_ofs_;
+    std::unique_ptr<std::ofstream> columnar_ofs_;
+
+    // Created along with columnar_ofs_, which it writes.
+    std::unique_ptr<columnar_ledger_writer> columnar_writer_;
 
     // Used only if emission_ includes mce_emit_group_quote; empty otherwise.
     std::unique_ptr<group_quote_pdf_generator> group_quote_pdf_gen_;
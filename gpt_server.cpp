@@ -47,6 +47,7 @@
 #include "premium_tax.hpp"
 #include "product_data.hpp"
 #include "round_to.hpp"
+#include "server_batch.hpp"
 #include "ssize_lmi.hpp"
 #include "stratified_algorithms.hpp"    // TieredGrossToNet()
 #include "stratified_charges.hpp"
@@ -56,9 +57,10 @@
 #include <boost/filesystem/convenience.hpp> // extension(), change_extension()
 #include <boost/filesystem/fstream.hpp>
 
-#include <algorithm>                    // min()
+#include <algorithm>                    // max(), min()
 #include <iostream>
 #include <string>
+#include <thread>                       // hardware_concurrency()
 #include <vector>
 
 namespace
@@ -532,6 +534,24 @@ bool gpt_server::operator()(fs::path const& file_path)
         }
 }
 
+/// Run many files concurrently, writing their final states to one table.
+///
+/// See run_server_batch(). Each row holds the guideline premiums
+/// (X0_glp through X7_gsp_c) that operator() computes for its file.
+
+void gpt_server::batch
+    (std::vector<fs::path> const& file_paths
+    ,std::ostream&                os
+    )
+{
+    run_server_batch
+        (*this
+        ,file_paths
+        ,os
+        ,std::max(1, static_cast<int>(std::thread::hardware_concurrency()))
+        );
+}
+
 bool gpt_server::operator()(fs::path const& file_path, gpt_input const& z)
 {
     Timer timer;
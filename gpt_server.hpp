@@ -30,6 +30,9 @@
 
 #include <boost/filesystem/path.hpp>
 
+#include <iosfwd>
+#include <vector>
+
 class gpt_input;
 
 /// Guideline premium test server.
@@ -53,6 +56,8 @@ class LMI_SO gpt_server final
     bool operator()(fs::path const&);
     bool operator()(fs::path const&, gpt_input const&);
 
+    void batch(std::vector<fs::path> const&, std::ostream&);
+
     void conditionally_show_timings_on_stdout() const;
 
     gpt_state state() const;
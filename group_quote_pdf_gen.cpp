@@ -23,7 +23,15 @@
 
 #include "group_quote_pdf_gen.hpp"
 
+#include "alert.hpp"
+#include "bourn_cast.hpp"
 #include "callback.hpp"
+#include "ledger.hpp"
+#include "ledger_invariant.hpp"
+#include "ledger_text_formats.hpp"      // ledger_format()
+#include "oecumenic_enumerations.hpp"
+
+#include <utility>                      // pair
 
 namespace
 {
@@ -44,3 +52,111 @@ std::unique_ptr<group_quote_pdf_generator> group_quote_pdf_generator::create()
 {
     return group_quote_pdf_generator_create_callback()();
 }
+
+/// First-year value of a totalled column.
+
+double group_quote_amount
+    (LedgerInvariant const&   invar
+    ,enum_group_quote_columns column
+    )
+{
+    int const year = 0;
+    switch(column)
+        {
+        case e_col_basic_face_amount:
+            return invar.SpecAmt.at(year);
+        case e_col_basic_premium:
+            return invar.ErModalMinimumPremium.at(year);
+        case e_col_supplemental_face_amount:
+            return invar.TermSpecAmt.at(year);
+        case e_col_additional_premium:
+            return invar.EeModalMinimumPremium.at(year);
+        case e_col_total_face_amount:
+            return invar.SpecAmt.at(year) + invar.TermSpecAmt.at(year);
+        case e_col_total_premium:
+            return invar.ModalMinimumPremium.at(year);
+        case e_col_number:
+        case e_col_name:
+        case e_col_age:
+        case e_col_dob:
+        case e_col_max:
+            {
+            alarum() << "Column " << column << " is not totalled." << LMI_FLUSH;
+            }
+        }
+    throw "Unreachable--silences a compiler diagnostic.";
+}
+
+/// Text of each column of one row of a group quote's main table.
+///
+/// A row's text depends only on its ledger and its (0-based) row
+/// number, and is formatted without wx, so rows can be prepared
+/// independently--even concurrently--and only drawing them needs a
+/// device context.
+///
+/// The date of birth is left empty: it's formatted with the other
+/// dates in the quote, by wx, when the row is drawn.
+
+std::vector<std::string> group_quote_row
+    (Ledger const& ledger
+    ,int           row_number
+    )
+{
+    LedgerInvariant const& invar = ledger.GetLedgerInvariant();
+
+    std::pair<int,oenum_format_style> const f0(0, oe_format_normal);
+    std::pair<int,oenum_format_style> const f2(2, oe_format_normal);
+
+    std::vector<std::string> z(e_col_max);
+    for(int i = 0; i < e_col_max; ++i)
+        {
+        // The cast is only used to ensure that if any new elements are added
+        // to the enum, the compiler would warn about their values not being
+        // present in this switch.
+        auto const column = static_cast<enum_group_quote_columns>(i);
+        switch(column)
+            {
+            case e_col_number:
+                {
+                // Row numbers shown to human beings should be 1-based.
+                z[i] = std::to_string(row_number + 1);
+                }
+                break;
+            case e_col_name:
+                {
+                z[i] = invar.Insured1;
+                }
+                break;
+            case e_col_age:
+                {
+                z[i] = std::to_string(bourn_cast<int>(invar.Age));
+                }
+                break;
+            case e_col_dob:
+                {
+                // Formatted when drawn--see above.
+                }
+                break;
+            case e_col_basic_face_amount:
+            case e_col_supplemental_face_amount:
+            case e_col_total_face_amount:
+                {
+                z[i] = '$' + ledger_format(group_quote_amount(invar, column), f0);
+                }
+                break;
+            case e_col_basic_premium:
+            case e_col_additional_premium:
+            case e_col_total_premium:
+                {
+                z[i] = '$' + ledger_format(group_quote_amount(invar, column), f2);
+                }
+                break;
+            case e_col_max:
+                {
+                alarum() << "Unreachable." << LMI_FLUSH;
+                }
+                break;
+            }
+        }
+    return z;
+}
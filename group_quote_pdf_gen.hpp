@@ -28,8 +28,36 @@
 
 #include <memory>                       // unique_ptr
 #include <string>
+#include <vector>
 
 class Ledger;
+class LedgerInvariant;
+
+enum enum_group_quote_columns
+    {e_col_number
+    ,e_col_name
+    ,e_col_age
+    ,e_col_dob
+    ,e_col_basic_face_amount
+    ,e_col_basic_premium
+    ,e_col_supplemental_face_amount
+    ,e_col_additional_premium
+    ,e_col_total_face_amount
+    ,e_col_total_premium
+    ,e_col_max
+    };
+
+enum_group_quote_columns const e_first_totalled_column = e_col_basic_face_amount;
+
+LMI_SO double group_quote_amount
+    (LedgerInvariant const&   invar
+    ,enum_group_quote_columns column
+    );
+
+LMI_SO std::vector<std::string> group_quote_row
+    (Ledger const& ledger
+    ,int           row_number
+    );
 
 /// Abstract base class for generating group premium quote PDFs.
 ///
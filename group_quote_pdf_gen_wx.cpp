@@ -33,11 +33,11 @@
 #include "ledger_invariant.hpp"
 #include "ledger_text_formats.hpp"      // ledger_format()
 #include "ledger_variant.hpp"
-#include "math_functions.hpp"           // outward_quotient()
 #include "mc_enum_types_aux.hpp"        // is_subject_to_ill_reg()
 #include "miscellany.hpp"               // split_into_lines()
 #include "oecumenic_enumerations.hpp"
 #include "pdf_writer_wx.hpp"
+#include "report_table.hpp"              // rows_on_each_page()
 #include "ssize_lmi.hpp"
 #include "version.hpp"
 #include "wx_table_generator.hpp"
@@ -172,22 +172,6 @@ std::vector<extra_summary_field> parse_extra_report_fields(std::string const& s)
     return fields;
 }
 
-enum enum_group_quote_columns
-    {e_col_number
-    ,e_col_name
-    ,e_col_age
-    ,e_col_dob
-    ,e_col_basic_face_amount
-    ,e_col_basic_premium
-    ,e_col_supplemental_face_amount
-    ,e_col_additional_premium
-    ,e_col_total_face_amount
-    ,e_col_total_premium
-    ,e_col_max
-    };
-
-enum_group_quote_columns const e_first_totalled_column = e_col_basic_face_amount;
-
 struct column_definition
 {
     char const*              header_;
@@ -235,19 +219,6 @@ class group_quote_pdf_generator_wx
     // preferences.
     static int const vert_skip = 12;
 
-    // Compute the number of pages needed by the table rows in the output given
-    // the space remaining on the first page, the heights of the header, one
-    // table row and the footer and the last row position.
-    // Remaining space contains the space on the first page on input and is
-    // updated with the space remaining on the last page on output.
-    int compute_pages_for_table_rows
-        (pdf_writer_wx& pdf_writer
-        ,int          & remaining_space
-        ,int            header_height
-        ,int            row_height
-        ,int            last_row_y
-        );
-
     void output_page_number_and_version
         (pdf_writer_wx& pdf_writer
         ,int            total_pages
@@ -302,6 +273,8 @@ class group_quote_pdf_generator_wx
     struct row_data
         {
         std::vector<std::string> output_values {e_col_max};
+        // Formatted by wx only when drawn, like the other dates.
+        jdn_t date_of_birth;
         };
     std::vector<row_data> rows_;
 
@@ -503,112 +476,8 @@ void group_quote_pdf_generator_wx::add_ledger(Ledger const& ledger)
             }
         }
 
-    int const year = 0;
-
-    std::pair<int,oenum_format_style> const f0(0, oe_format_normal);
-    std::pair<int,oenum_format_style> const f2(2, oe_format_normal);
-
     bool const is_composite = ledger.is_composite();
 
-    row_data rd;
-    for(int i = 0; i < e_col_max; ++i)
-        {
-        // The cast is only used to ensure that if any new elements are added
-        // to the enum, the compiler would warn about their values not being
-        // present in this switch.
-        switch(static_cast<enum_group_quote_columns>(i))
-            {
-            case e_col_number:
-                {
-                // Row numbers shown to human beings should be 1-based.
-                rd.output_values[i] = wxString::Format("%d", row_num_ + 1).ToStdString();
-                }
-                break;
-            case e_col_name:
-                {
-                rd.output_values[i] = invar.Insured1;
-                }
-                break;
-            case e_col_age:
-                {
-                rd.output_values[i] = wxString::Format("%.0f", invar.Age).ToStdString();
-                }
-                break;
-            case e_col_dob:
-                {
-                rd.output_values[i] = ConvertDateToWx
-                    (jdn_t(static_cast<int>(invar.DateOfBirthJdn))
-                    ).FormatDate().ToStdString(wxConvUTF8);
-                }
-                break;
-            case e_col_basic_face_amount:
-                {
-                double const z = invar.SpecAmt.at(year);
-                rd.output_values[i] = '$' + ledger_format(z, f0);
-                if(is_composite)
-                    {
-                    totals_.total(i, z);
-                    }
-                }
-                break;
-            case e_col_basic_premium:
-                {
-                double const z = invar.ErModalMinimumPremium.at(year);
-                rd.output_values[i] = '$' + ledger_format(z, f2);
-                if(is_composite)
-                    {
-                    totals_.total(i, z);
-                    }
-                }
-                break;
-            case e_col_supplemental_face_amount:
-                {
-                double const z = invar.TermSpecAmt.at(year);
-                rd.output_values[i] = '$' + ledger_format(z, f0);
-                if(is_composite)
-                    {
-                    totals_.total(i, z);
-                    }
-                }
-                break;
-            case e_col_additional_premium:
-                {
-                double const z = invar.EeModalMinimumPremium.at(year);
-                rd.output_values[i] = '$' + ledger_format(z, f2);
-                if(is_composite)
-                    {
-                    totals_.total(i, z);
-                    }
-                }
-                break;
-            case e_col_total_face_amount:
-                {
-                double const z = invar.SpecAmt.at(year) + invar.TermSpecAmt.at(year);
-                rd.output_values[i] = '$' + ledger_format(z, f0);
-                if(is_composite)
-                    {
-                    totals_.total(i, z);
-                    }
-                }
-                break;
-            case e_col_total_premium:
-                {
-                double const z = invar.ModalMinimumPremium.at(year);
-                rd.output_values[i] = '$' + ledger_format(z, f2);
-                if(is_composite)
-                    {
-                    totals_.total(i, z);
-                    }
-                }
-                break;
-            case e_col_max:
-                {
-                alarum() << "Unreachable." << LMI_FLUSH;
-                }
-                break;
-            }
-        }
-
     // The composite ledger arrives last. It is used only for global
     // data (which have already been asserted, upstream, not to vary
     // by cell) and for totals. It is neither shown in the main table
@@ -617,11 +486,19 @@ void group_quote_pdf_generator_wx::add_ledger(Ledger const& ledger)
     // total columns) be suppressed.
     if(is_composite)
         {
+        for(int i = e_first_totalled_column; i < e_col_max; ++i)
+            {
+            auto const column = static_cast<enum_group_quote_columns>(i);
+            totals_.total(i, group_quote_amount(invar, column));
+            }
         report_data_.fill_global_report_data(ledger, totals_);
         }
     else
         {
-        rows_.push_back(rd);
+        rows_.push_back
+            ({group_quote_row(ledger, row_num_)
+             ,jdn_t(static_cast<int>(invar.DateOfBirthJdn))
+            });
         ++row_num_;
         }
 }
@@ -729,16 +606,25 @@ void group_quote_pdf_generator_wx::save(std::string const& output_filename)
     output_footer(pdf_writer, y_after_footer, oe_only_measure);
     int const footer_height = y_after_footer - pos_y;
 
-    int const last_row_y = pdf_writer.get_page_bottom();
-    int remaining_space = last_row_y - pos_y;
-
-    int total_pages = compute_pages_for_table_rows
-        (pdf_writer
-        ,remaining_space
-        ,header_height
-        ,table_gen.row_height()
-        ,last_row_y
+    // Lay out all pages before drawing any row: rows have a uniform
+    // height, so the number that fit on each page is known without
+    // measuring their contents.
+    int const row_height  = table_gen.row_height();
+    int const last_row_y  = pdf_writer.get_page_bottom();
+    int const first_row_y = pdf_writer.get_vert_margin() + header_height;
+    std::vector<int> const page_rows = rows_on_each_page
+        (lmi::ssize(rows_)
+        ,(last_row_y - pos_y) / row_height
+        ,(last_row_y - first_row_y) / row_height
         );
+    int const last_page_area =
+          1 == lmi::ssize(page_rows)
+        ? last_row_y - pos_y
+        : last_row_y - first_row_y
+        ;
+    int const remaining_space = last_page_area - page_rows.back() * row_height;
+
+    int total_pages = lmi::ssize(page_rows);
 
     // Check if the footer fits into the same page or if it needs a new one (we
     // never want to have a page break in the footer).
@@ -749,23 +635,21 @@ void group_quote_pdf_generator_wx::save(std::string const& output_filename)
         ++total_pages;
         }
 
-    int current_page = 1;
-
-    for(auto const& i : rows_)
+    std::vector<int> visible_columns;
+    for(int j = 0; j < e_col_max; ++j)
         {
-        LMI_ASSERT(lmi::ssize(i.output_values) == lmi::ssize(column_definitions));
-        std::vector<std::string> visible_values;
-        for(int j = 0; j < e_col_max; ++j)
+        if(oe_shown == column_definitions[j].visibility_)
             {
-            if(oe_shown == column_definitions[j].visibility_)
-                {
-                visible_values.push_back(i.output_values[j]);
-                }
+            visible_columns.push_back(j);
             }
+        }
 
-        // If there is no space left for this row on the current page, start a
-        // new one.
-        if(last_row_y <= pos_y + table_gen.row_height())
+    int current_page = 1;
+
+    auto row = rows_.begin();
+    for(int page = 0; page < lmi::ssize(page_rows); ++page)
+        {
+        if(0 != page)
             {
             output_page_number_and_version(pdf_writer, total_pages, current_page);
 
@@ -776,8 +660,28 @@ void group_quote_pdf_generator_wx::save(std::string const& output_filename)
             table_gen.output_headers(pos_y);
             }
 
-        table_gen.output_row(pos_y, visible_values);
+        for(int k = 0; k < page_rows[page]; ++k, ++row)
+            {
+            LMI_ASSERT(lmi::ssize(row->output_values) == e_col_max);
+            std::vector<std::string> visible_values;
+            for(int j : visible_columns)
+                {
+                if(e_col_dob == j)
+                    {
+                    visible_values.push_back
+                        (ConvertDateToWx(row->date_of_birth)
+                            .FormatDate().ToStdString(wxConvUTF8)
+                        );
+                    }
+                else
+                    {
+                    visible_values.push_back(row->output_values[j]);
+                    }
+                }
+            table_gen.output_row(pos_y, visible_values);
+            }
         }
+    LMI_ASSERT(rows_.end() == row);
 
     if(footer_on_its_own_page)
         {
@@ -801,44 +705,6 @@ void group_quote_pdf_generator_wx::save(std::string const& output_filename)
     pdf_writer.save();
 }
 
-int group_quote_pdf_generator_wx::compute_pages_for_table_rows
-    (pdf_writer_wx& pdf_writer
-    ,int          & remaining_space
-    ,int            header_height
-    ,int            row_height
-    ,int            last_row_y
-    )
-{
-    int total_pages = 1;
-
-    int const max_rows_on_first_page = remaining_space / row_height;
-    int remaining_rows = static_cast<int>(rows_.size());
-    if(max_rows_on_first_page < remaining_rows)
-        {
-        // All rows don't fit on the first page, so add enough pages for the
-        // rest of them.
-        remaining_rows -= max_rows_on_first_page;
-
-        int const first_row_y = pdf_writer.get_vert_margin() + header_height;
-        int const page_area_y = last_row_y - first_row_y;
-        int const rows_per_page = page_area_y / row_height;
-        total_pages += outward_quotient(remaining_rows, rows_per_page);
-        remaining_space = page_area_y;
-        remaining_rows %= rows_per_page;
-        if(!remaining_rows)
-            {
-            // If no rows remain, it actually means that the last page has the
-            // maximum amount of rows as we don't have an extra page with 0
-            // rows in this case.
-            remaining_rows = rows_per_page;
-            }
-        }
-
-    remaining_space -= remaining_rows * row_height;
-
-    return total_pages;
-}
-
 void group_quote_pdf_generator_wx::output_page_number_and_version
     (pdf_writer_wx& pdf_writer
     ,int            total_pages
@@ -28,6 +28,8 @@
 #include "assert_lmi.hpp"
 #include "configurable_settings.hpp"
 #include "contains.hpp"
+#include "database.hpp"
+#include "dbnames.hpp"
 #include "emit_ledger.hpp"
 #include "fenv_guard.hpp"
 #include "input.hpp"
@@ -39,7 +41,7 @@
 #include "progress_meter.hpp"
 #include "ssize_lmi.hpp"
 #include "timer.hpp"
-#include "value_cast.hpp"
+#include "yare_input.hpp"
 
 #include <algorithm>                    // max()
 #include <iterator>                     // back_inserter()
@@ -47,12 +49,9 @@
 
 namespace
 {
-bool cell_should_be_ignored(Input const& cell)
+bool cell_should_be_ignored(yare_input const& cell)
 {
-    return
-            0     == value_cast<int>(cell["NumberOfIdenticalLives"].str())
-        ||  "Yes" !=                 cell["IncludeInComposite"    ].str()
-        ;
+    return 0 == cell.NumberOfIdenticalLives || !cell.IncludeInComposite;
 }
 
 /// Number of seconds to pause between printouts.
@@ -91,10 +90,10 @@ class run_census_in_series
 {
   public:
     census_run_result operator()
-        (fs::path           const& file
-        ,mcenum_emission           emission
-        ,std::vector<Input> const& cells
-        ,Ledger                  & composite
+        (fs::path                const& file
+        ,mcenum_emission                emission
+        ,std::vector<yare_input> const& cells
+        ,Ledger                       & composite
         );
 };
 
@@ -102,18 +101,18 @@ class run_census_in_parallel
 {
   public:
     census_run_result operator()
-        (fs::path           const& file
-        ,mcenum_emission           emission
-        ,std::vector<Input> const& cells
-        ,Ledger                  & composite
+        (fs::path                const& file
+        ,mcenum_emission                emission
+        ,std::vector<yare_input> const& cells
+        ,Ledger                       & composite
         );
 };
 
 census_run_result run_census_in_series::operator()
-    (fs::path           const& file
-    ,mcenum_emission    const  emission
-    ,std::vector<Input> const& cells
-    ,Ledger                  & composite
+    (fs::path                const& file
+    ,mcenum_emission         const  emission
+    ,std::vector<yare_input> const& cells
+    ,Ledger                       & composite
     )
 {
     Timer timer;
@@ -133,7 +132,7 @@ census_run_result run_census_in_series::operator()
         {
         if(!cell_should_be_ignored(cells[j]))
             {
-            std::string const name(cells[j]["InsuredName"].str());
+            std::string const& name = cells[j].InsuredName;
             IllusVal IV(serial_file_path(file, name, j, "hastur").string());
             IV.run(cells[j]);
             composite.PlusEq(*IV.ledger());
@@ -233,10 +232,10 @@ census_run_result run_census_in_series::operator()
 /// on an illustration.
 
 census_run_result run_census_in_parallel::operator()
-    (fs::path           const& file
-    ,mcenum_emission    const  emission
-    ,std::vector<Input> const& cells
-    ,Ledger                  & composite
+    (fs::path                const& file
+    ,mcenum_emission         const  emission
+    ,std::vector<yare_input> const& cells
+    ,Ledger                       & composite
     )
 {
     Timer timer;
@@ -254,8 +253,8 @@ census_run_result run_census_in_parallel::operator()
     std::vector<AccountValue> cell_values;
     std::vector<mcenum_run_basis> const& RunBases = composite.GetRunBases();
 
-    int const first_cell_inforce_year  = value_cast<int>((*cells.begin())["InforceYear"].str());
-    int const first_cell_inforce_month = value_cast<int>((*cells.begin())["InforceMonth"].str());
+    int const first_cell_inforce_year  = cells.front().InforceYear;
+    int const first_cell_inforce_month = cells.front().InforceMonth;
     cell_values.reserve(cells.size());
     int j = 0;
     for(auto const& ip : cells)
@@ -270,7 +269,7 @@ census_run_result run_census_in_parallel::operator()
             cell_values.emplace_back(ip);
             AccountValue& av = cell_values.back();
 
-            std::string const name(cells[j]["InsuredName"].str());
+            std::string const& name = cells[j].InsuredName;
             // Indexing: here, j is an index into cells, not cell_values.
             av.SetDebugFilename
                 (serial_file_path(file, name, j, "hastur").string()
@@ -636,7 +635,7 @@ census_run_result run_census_in_parallel::operator()
     for(auto const& i : cell_values)
         {
         // Indexing: here, j is an index into cell_values, not cells.
-        std::string const name(cells[j]["InsuredName"].str());
+        std::string const& name = cells[j].InsuredName;
         result.seconds_for_output_ += emitter.emit_cell
             (serial_file_path(file, name, j, "hastur")
             ,*i.ledger_from_av()
@@ -669,15 +668,37 @@ census_run_result run_census::operator()
     ,mcenum_emission    const  emission
     ,std::vector<Input> const& cells
     )
+{
+    return operator()(file, emission, yare_cells(cells, false));
+}
+
+/// Run cells already converted by yare_cells().
+///
+/// Only the compact form of each cell is held during the run, so a
+/// caller that has no further use for its Input objects may destroy
+/// them first.
+
+census_run_result run_census::operator()
+    (fs::path                const& file
+    ,mcenum_emission         const  emission
+    ,std::vector<yare_input> const& cells
+    )
 {
     census_run_result result;
 
+    LMI_ASSERT(!cells.empty());
+    // Each realized sequence has one element per year to maturity, so
+    // no product_database need be constructed for each cell just to
+    // find its length.
     int composite_length = 0;
     for(auto const& i : cells)
         {
         if(!cell_should_be_ignored(i))
             {
-            composite_length = std::max(composite_length, i.years_to_maturity());
+            composite_length = std::max
+                (composite_length
+                ,lmi::ssize(i.SpecifiedAmount)
+                );
             }
         }
     // If cell_should_be_ignored() is true for all cells, composite
@@ -685,7 +706,7 @@ census_run_result run_census::operator()
     composite_.reset
         (new Ledger
             (composite_length
-            ,cells[0].ledger_type()
+            ,product_database(cells[0]).query<mcenum_ledger_type>(DB_LedgerType)
             ,false
             ,false
             ,true
@@ -695,7 +716,7 @@ census_run_result run_census::operator()
     // Use the first cell's run order for the entire census, ignoring
     // any conflicting run order for any other cell--which would have
     // been prevented upstream by assert_consistent_run_order().
-    switch(yare_input(cells[0]).RunOrder)
+    switch(cells[0].RunOrder)
         {
         case mce_life_by_life:
             {
@@ -34,6 +34,7 @@
 
 class Input;
 class Ledger;
+class yare_input;
 
 /// Result of running a census.
 ///
@@ -82,6 +83,11 @@ class LMI_SO run_census final
         ,mcenum_emission           emission
         ,std::vector<Input> const& cells
         );
+    census_run_result operator()
+        (fs::path                const& file
+        ,mcenum_emission                emission
+        ,std::vector<yare_input> const& cells
+        );
 
     std::shared_ptr<Ledger const> composite() const;
 
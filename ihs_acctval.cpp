@@ -30,6 +30,7 @@
 #include "database.hpp"
 #include "dbnames.hpp"
 #include "death_benefits.hpp"
+#include "fenv_lmi.hpp"
 #include "ihs_irc7702.hpp"
 #include "ihs_irc7702a.hpp"
 #include "input.hpp"                    // consummate()
@@ -48,6 +49,8 @@
 
 #include <algorithm>
 #include <cmath>
+#include <exception>                    // exception_ptr
+#include <future>
 #include <iterator>                     // back_inserter()
 #include <limits>
 #include <numeric>
@@ -83,7 +86,17 @@ showing {accesses, modifies current year, modifies future years}
 
 //============================================================================
 AccountValue::AccountValue(Input const& input)
-    :BasicValues           (Input::consummate(input))
+    :AccountValue {yare_input(Input::consummate(input))}
+{
+}
+
+/// Construct from input that has already been consummated.
+///
+/// See Input::consummate() and yare_cells(); the Input ctor above
+/// delegates to this one.
+
+AccountValue::AccountValue(yare_input const& consummated_input)
+    :BasicValues           (consummated_input)
     ,DebugFilename         {"anonymous.monthly_trace"}
     ,Debugging             {false}
     ,Solving               {mce_solve_none != BasicValues::yare_input_.SolveType}
@@ -205,6 +218,7 @@ Then run other bases.
         DebugPrintInit();
         }
 
+    checkpoints_.clear();
     double z = RunAllApplicableBases();
 
     FinalizeLifeAllBases();
@@ -212,6 +226,169 @@ Then run other bases.
     return z;
 }
 
+/// Resume an illustration from a checkpoint.
+///
+/// Call this instead of RunAV() on a newly-constructed object, which
+/// supplies the ledger that receives the results. The current basis
+/// runs only the years from the checkpoint onward, and the resulting
+/// ledger is identical to what RunAV() would produce.
+///
+/// The checkpoint must have been taken for an input that differs
+/// from this object's only as first_affected_year() permits. Absent
+/// a solve, the transactions that may differ are taken from this
+/// object: they are read one year at a time, so those for years
+/// before the checkpoint were the same for both inputs.
+///
+/// Only the current basis is resumed. Every other basis starts from
+/// the state that the current basis leaves behind--overriding outlay
+/// for all years, and an invariant ledger whose later entries the
+/// current basis may rewrite (e.g., specamt carried forward)--so its
+/// state at the checkpoint year may depend on years that differ.
+/// The other bases are therefore run in full on the resumed object,
+/// exactly as RunAllApplicableBases() runs them.
+///
+/// Any monthly trace is written afresh, so it shows only the years
+/// resumed.
+///
+/// State is kept in memory, not serialized: all the objects that
+/// are modified during a projection are copied, and read-only rate
+/// tables are shared. Thus, a checkpoint can't outlive the process
+/// that took it.
+
+double AccountValue::ResumeAV(projection_checkpoint const& cp)
+{
+    std::vector<mcenum_run_basis> const& bases = ledger_->GetRunBases();
+    LMI_ASSERT(mce_run_gen_curr_sep_full == bases.front());
+
+    std::shared_ptr<AccountValue> av = cp.current_->clone();
+    LMI_ASSERT(mce_run_gen_curr_sep_full == av->RunBasis_);
+    av->ledger_ = ledger_;
+    if(av->Debugging)
+        {
+        av->DebugFilename = DebugFilename;
+        av->DebugPrintInit();
+        }
+    if(mce_solve_none == yare_input_.SolveType)
+        {
+        av->yare_input_ = yare_input_;
+        av->DeathBfts_  = std::make_shared<death_benefits>(*DeathBfts_);
+        av->Outlay_     = std::make_shared<modal_outlay  >(*Outlay_   );
+        LedgerInvariant& invariant = av->InvariantValues();
+        for(int year = cp.year_; year < BasicValues::GetLength(); ++year)
+            {
+            invariant.DBOpt [year] = DeathBfts_->dbopt()[year];
+            invariant.EeMode[year] = Outlay_->ee_premium_modes()[year];
+            invariant.ErMode[year] = Outlay_->er_premium_modes()[year];
+            }
+        }
+    av->ContinueOneCell(av->RunBasis_, cp.year_);
+    av->concurrent_bases_ = concurrent_bases_;
+    av->RunBasesAfterCurrent();
+    av->FinalizeLifeAllBases();
+
+    return cp.solve_result_;
+}
+
+/// Earliest year whose projection may differ between two inputs.
+///
+/// A checkpoint taken for either input can be resumed for the other
+/// if it was taken no later than this year. Only transactions that a
+/// projection reads one year at a time, through classes modal_outlay
+/// and death_benefits, may differ. Any other difference yields zero,
+/// as does any difference at all if there is a solve, because solves
+/// depend on every year.
+
+int first_affected_year(Input const& a, Input const& b)
+{
+    static std::vector<std::string> const transactions
+        {"CorporationPayment"
+        ,"CorporationPaymentMode"
+        ,"DeathBenefitOption"
+        ,"NewLoan"
+        ,"Payment"
+        ,"PaymentMode"
+        ,"Withdrawal"
+        };
+
+    Input const x(Input::consummate(a));
+    Input const y(Input::consummate(b));
+    for(auto const& i : x.member_names())
+        {
+        if(x[i] != y[i] && !contains(transactions, i))
+            {
+            return 0;
+            }
+        }
+
+    yare_input const u(x);
+    yare_input const v(y);
+    int const z = first_differing_duration(u, v);
+    bool const identical = lmi::ssize(u.Payment) == z;
+    return (identical || mce_solve_none == u.SolveType) ? z : 0;
+}
+
+/// Capture checkpoints at years that are multiples of an interval.
+///
+/// RunAV() then records the state of the current basis just before
+/// it processes each such year after the inforce year. Solves and
+/// guaranteed-premium calculations are not captured: only the final
+/// run is. Nonpositive values (the default) capture nothing.
+
+void AccountValue::set_checkpoint_interval(int years)
+{
+    checkpoint_interval_ = years;
+}
+
+/// Checkpoints captured by the last call to RunAV(), in year order.
+
+std::vector<std::shared_ptr<projection_checkpoint const>> AccountValue::checkpoints() const
+{
+    return {checkpoints_.begin(), checkpoints_.end()};
+}
+
+/// Copy of this object whose projection state is independent.
+///
+/// The defaulted copy ctor shares every shared_ptr member;
+/// replace those whose pointees change during a projection. The
+/// copy gets an empty ledger, and a monthly-trace stream that isn't
+/// opened unless DebugPrintInit() is called for it, so that nothing
+/// it does can be seen through this object.
+
+std::shared_ptr<AccountValue> AccountValue::clone() const
+{
+    std::shared_ptr<AccountValue> z(new AccountValue(*this));
+    z->InterestRates_    = std::make_shared<InterestRates  >(*InterestRates_   );
+    z->DeathBfts_        = std::make_shared<death_benefits >(*DeathBfts_       );
+    z->Outlay_           = std::make_shared<modal_outlay   >(*Outlay_          );
+    z->PremiumTax_       = std::make_shared<premium_tax    >(*PremiumTax_      );
+    z->Irc7702_          = std::make_shared<Irc7702        >(*Irc7702_         );
+    z->Irc7702A_         = std::make_shared<Irc7702A       >(*Irc7702A_        );
+    z->ledger_invariant_ = std::make_shared<LedgerInvariant>(*ledger_invariant_);
+    z->ledger_variant_   = std::make_shared<LedgerVariant  >(*ledger_variant_  );
+    z->ledger_ = std::make_shared<Ledger>
+        (BasicValues::GetLength()
+        ,BasicValues::ledger_type()
+        ,BasicValues::nonillustrated()
+        ,BasicValues::no_can_issue()
+        ,false
+        );
+    z->DebugStream = std::make_shared<std::ofstream>();
+    z->checkpoint_interval_ = 0;
+    z->checkpoints_.clear();
+    return z;
+}
+
+/// Record the current basis's state in a new checkpoint.
+
+void AccountValue::TakeCheckpoint()
+{
+    LMI_ASSERT(mce_run_gen_curr_sep_full == RunBasis_);
+    auto z = std::make_shared<projection_checkpoint>();
+    z->year_    = Year;
+    z->current_ = clone();
+    checkpoints_.push_back(z);
+}
+
 //============================================================================
 // TODO ?? Perhaps commutation functions could be used to speed up
 // this rather expensive function.
@@ -306,14 +483,135 @@ double AccountValue::RunAllApplicableBases()
         // on the solve basis.
         }
     // Run all bases, current first.
-    for(auto const& b : ledger_->GetRunBases())
+    std::vector<mcenum_run_basis> const& bases = ledger_->GetRunBases();
+    LMI_ASSERT(!bases.empty());
+    LMI_ASSERT(mce_run_gen_curr_sep_full == bases.front());
+    RunOneBasis(bases.front());
+    RunBasesAfterCurrent();
+    for(auto const& i : checkpoints_)
         {
-        RunOneBasis(b);
+        i->solve_result_ = z;
         }
     return z;
 }
 
+/// Run every basis but current, which must already have been run.
+///
+/// The other bases read the overriding outlay that the current basis
+/// determined, and run in the order of GetRunBases(): in sequence, or
+/// concurrently if set_concurrent_bases() says so.
+
+void AccountValue::RunBasesAfterCurrent()
+{
+    if(concurrent_bases_ && !Debugging)
+        {
+        RunBasesConcurrently();
+        return;
+        }
+
+    std::vector<mcenum_run_basis> const& bases = ledger_->GetRunBases();
+    for(int j = 1; j < lmi::ssize(bases); ++j)
+        {
+        RunOneBasis(bases[j]);
+        }
+}
+
+/// Run every basis but current, each on its own thread.
+///
+/// Each basis but the last runs on a clone() with a ledger of its
+/// own, and the last runs on this object meanwhile, so that this
+/// object is left in the state that running bases in sequence would
+/// leave it in. Every thread is joined before anything is rethrown;
+/// then the exception rethrown, if any, is the one that a sequential
+/// run would have thrown: the earliest basis's, in the order of
+/// GetRunBases(), which is also the order in which ledgers are merged.
+///
+/// Floating-point control words are thread-specific, so each thread
+/// sets its own.
+
+void AccountValue::RunBasesConcurrently()
+{
+    std::vector<mcenum_run_basis> const& bases = ledger_->GetRunBases();
+    if(lmi::ssize(bases) < 2)
+        {
+        return;
+        }
+
+    std::vector<std::shared_ptr<AccountValue>> clones;
+    std::vector<std::future<double>> results;
+    for(int j = 1; j < lmi::ssize(bases) - 1; ++j)
+        {
+        std::shared_ptr<AccountValue> av = clone();
+        clones.push_back(av);
+        mcenum_run_basis const b = bases[j];
+        results.push_back
+            (std::async
+                (std::launch::async
+                ,[av, b]() {fenv_initialize(); return av->RunOneBasis(b);}
+                )
+            );
+        }
+
+    std::exception_ptr last_basis_exception;
+    try
+        {
+        RunOneBasis(bases.back());
+        }
+    catch(...)
+        {
+        last_basis_exception = std::current_exception();
+        }
+
+    std::exception_ptr earliest_exception;
+    for(int j = 0; j < lmi::ssize(clones); ++j)
+        {
+        try
+            {
+            results[j].get();
+            }
+        catch(...)
+            {
+            if(!earliest_exception)
+                {
+                earliest_exception = std::current_exception();
+                }
+            continue;
+            }
+        ledger_->SetOneLedgerVariant(bases[1 + j], clones[j]->VariantValues());
+        }
+    if(!earliest_exception)
+        {
+        earliest_exception = last_basis_exception;
+        }
+    if(earliest_exception)
+        {
+        std::rethrow_exception(earliest_exception);
+        }
+}
+
+/// Run bases other than current concurrently: see RunBasesConcurrently().
+///
+/// The ledger is the same either way. This has no effect when
+/// debugging, because the monthly trace presumes sequential runs.
+/// Alerts raised on worker threads are displayed by the alert
+/// functions in effect, which must therefore be safe to call from
+/// any thread: the command-line and server interfaces' are, but
+/// wx's are not.
+
+void AccountValue::set_concurrent_bases(bool z)
+{
+    concurrent_bases_ = z;
+}
+
 //============================================================================
+double AccountValue::RunOneCell(mcenum_run_basis a_Basis)
+{
+    InitializeLife(a_Basis);
+    return ContinueOneCell(a_Basis, InforceYear);
+}
+
+/// Project one basis from the beginning of 'first_year' to maturity.
+///
 /// This implementation seems slightly unnatural because it strives
 /// for similarity with run_census_in_parallel::operator(). For
 /// instance, 'Year' and 'Month' aren't used directly as loop
@@ -322,13 +620,22 @@ double AccountValue::RunAllApplicableBases()
 /// which isn't necessary anyway because all the functions it calls
 /// contain such a condition.
 
-double AccountValue::RunOneCell(mcenum_run_basis a_Basis)
+double AccountValue::ContinueOneCell(mcenum_run_basis a_Basis, int first_year)
 {
-    InitializeLife(a_Basis);
-
-    for(int year = InforceYear; year < BasicValues::GetLength(); ++year)
+    for(int year = first_year; year < BasicValues::GetLength(); ++year)
         {
         Year = year;
+        if
+            (   0 < checkpoint_interval_
+            &&  mce_run_gen_curr_sep_full == a_Basis
+            &&  InforceYear < Year
+            &&  0 == Year % checkpoint_interval_
+            && !Solving
+            && !SolvingForGuarPremium
+            )
+            {
+            TakeCheckpoint();
+            }
         CoordinateCounters();
         InitializeYear();
 
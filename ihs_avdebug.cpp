@@ -35,7 +35,9 @@
 #include "value_cast.hpp"
 
 #include <algorithm>
+#include <fstream>
 #include <iterator>                     // ostream_iterator
+#include <memory>                       // make_shared()
 #include <string>
 #include <vector>
 
@@ -277,13 +279,16 @@ void AccountValue::DebugPrintInit()
         return;
         }
 
-    DebugStream.open(DebugFilename.c_str(), ios_out_trunc_binary());
+    DebugStream = std::make_shared<std::ofstream>
+        (DebugFilename.c_str()
+        ,ios_out_trunc_binary()
+        );
     std::copy
         (DebugColHeaders().begin()
         ,DebugColHeaders().end()
-        ,std::ostream_iterator<std::string>(DebugStream, "\t")
+        ,std::ostream_iterator<std::string>(*DebugStream, "\t")
         );
-    DebugStream << '\n';
+    *DebugStream << '\n';
 }
 
 //============================================================================
@@ -293,7 +298,7 @@ void AccountValue::DebugEndBasis()
         {
         return;
         }
-    DebugStream << '\n';
+    *DebugStream << '\n';
 }
 
 //============================================================================
@@ -519,8 +524,8 @@ void AccountValue::DebugPrint()
     std::copy
         (DebugRecord.begin()
         ,DebugRecord.end()
-        ,std::ostream_iterator<std::string>(DebugStream, "\t")
+        ,std::ostream_iterator<std::string>(*DebugStream, "\t")
         );
-    DebugStream << '\n';
+    *DebugStream << '\n';
     DebugRecord.assign(eLast, "EMPTY");
 }
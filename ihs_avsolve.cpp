@@ -39,6 +39,8 @@
 #include "mc_enum_types_aux.hpp"        // set_run_basis_from_cloven_bases()
 #include "miscellany.hpp"               // ios_out_app_binary()
 #include "outlay.hpp"
+#include "solve_statistics.hpp"
+#include "timer.hpp"
 #include "zero.hpp"
 
 #include <algorithm>                    // min(), max()
@@ -62,8 +64,15 @@ class SolveHelper
         }
     double operator()(double a_CandidateValue)
         {
-        return av.SolveTest(a_CandidateValue);
+        Timer timer;
+        double const z = av.SolveTest(a_CandidateValue);
+        double const seconds = timer.stop().elapsed_seconds();
+        seconds_evaluating += seconds;
+        slowest_evaluation = std::max(slowest_evaluation, seconds);
+        return z;
         }
+    double seconds_evaluating {0.0};
+    double slowest_evaluation {0.0};
 };
 
 /// Return outcome of a trial with a given input value.
@@ -309,6 +318,19 @@ double AccountValue::SolveGuarPremium()
     return guar_premium;
 }
 
+/// Solve by extrapolating along secants where that's likely to help.
+///
+/// Specified-amount and premium solves for endowment or a target CSV
+/// are nearly linear, so secant_decimal_root() usually finds the same
+/// solution with fewer trial runs than decimal_root(). The solution
+/// could differ if the objective function had more than one root
+/// within the a priori bounds, so this is off by default.
+
+void AccountValue::set_secant_solves(bool z)
+{
+    secant_solves_ = z;
+}
+
 //============================================================================
 double AccountValue::Solve
     (mcenum_solve_type   a_SolveType
@@ -416,16 +438,70 @@ double AccountValue::Solve
         os_trace.rdbuf(ofs_trace.rdbuf());
         }
 
+    // Optionally, for solves whose objective function is nearly
+    // linear, extrapolate along secants from the lower bound and a
+    // plausible first guess, instead of starting with the a priori
+    // bounds, which are very far apart: see set_secant_solves().
+    bool const extrapolate =
+            secant_solves_
+        &&  (  mce_solve_specamt == a_SolveType
+            || mce_solve_ee_prem == a_SolveType
+            || mce_solve_er_prem == a_SolveType
+            )
+        &&  (  mce_solve_for_endt       == SolveTarget_
+            || mce_solve_for_target_csv == SolveTarget_
+            )
+        ;
+
     SolveHelper solve_helper(*this);
-    root_type solution = decimal_root
-        (lower_bound
-        ,upper_bound
-        ,bias
-        ,decimals
-        ,solve_helper
-        ,false
-        ,os_trace
-        );
+    solve_record statistics;
+    root_type solution;
+    if(extrapolate)
+        {
+        // Guess the input specified amount for a specamt solve, or a
+        // premium of one percent of it for a premium solve.
+        double const specamt = base_specamt(SolveBeginYear_);
+        double guess =
+            mce_solve_specamt == a_SolveType
+            ? specamt
+            : lower_bound + 0.01 * specamt
+            ;
+        if(guess <= lower_bound)
+            {
+            guess = lower_bound + 100000.0;
+            }
+        solution = secant_decimal_root
+            (lower_bound
+            ,upper_bound
+            ,lower_bound
+            ,guess
+            ,bias
+            ,decimals
+            ,solve_helper
+            ,false
+            ,os_trace
+            ,&statistics.root
+            );
+        }
+    else
+        {
+        solution = decimal_root
+            (lower_bound
+            ,upper_bound
+            ,bias
+            ,decimals
+            ,solve_helper
+            ,false
+            ,os_trace
+            ,&statistics.root
+            );
+        }
+
+    statistics.product_name       = yare_input_.ProductName;
+    statistics.solve_type         = a_SolveType;
+    statistics.seconds_evaluating = solve_helper.seconds_evaluating;
+    statistics.slowest_evaluation = solve_helper.slowest_evaluation;
+    solve_statistics::instance().record(statistics);
 
     if(root_not_bracketed == solution.second)
         {
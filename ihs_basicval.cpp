@@ -63,6 +63,12 @@
 
 //============================================================================
 BasicValues::BasicValues(Input const& input)
+    :BasicValues {yare_input(input)}
+{
+}
+
+//============================================================================
+BasicValues::BasicValues(yare_input const& input)
     :yare_input_         (input)
     ,product_            (yare_input_.ProductName)
     ,database_           (yare_input_)
@@ -227,14 +233,14 @@ void BasicValues::Init()
 
     // Mortality and interest rates require database and rounding.
     // Interest rates require tiered data and 7702 spread.
-    MortalityRates_.reset(new MortalityRates (*this));
+    MortalityRates_ = MortalityRates::shared_instance(*this);
     InterestRates_ .reset(new InterestRates  (*this));
     DeathBfts_     .reset(new death_benefits (GetLength(), yare_input_, round_specamt_));
     // Outlay requires only input and rounding; it might someday use
     // interest rates.
     Outlay_        .reset(new modal_outlay   (yare_input_, round_gross_premium_, round_withdrawal_, round_loan_));
     PremiumTax_    .reset(new premium_tax    (PremiumTaxState_, StateOfDomicile_, yare_input_.AmortizePremiumLoad, database(), *StratifiedCharges_));
-    Loads_         .reset(new Loads          (*this));
+    Loads_         = Loads::shared_instance(*this);
 
     // The target premium can't be ascertained yet if specamt is
     // determined by a strategy. This data member is used only by
@@ -145,11 +145,6 @@ Irc7702::Irc7702
     :Test7702           {a_Test7702}
     ,IssueAge           {a_IssueAge}
     ,EndtAge            {a_EndtAge}
-    ,Qc                 {a_Qc}
-    ,GLPic              {a_GLPic}
-    ,GSPic              {a_GSPic}
-    ,Ig                 {a_Ig}
-    ,IntDed             {a_IntDed}
     ,PresentBftAmt      {a_PresentBftAmt}
     ,PriorBftAmt        {a_PresentBftAmt}
     ,PresentSpecAmt     {a_PresentSpecAmt}
@@ -157,14 +152,8 @@ Irc7702::Irc7702
     ,LeastBftAmtEver    {a_LeastBftAmtEver}
     ,PresentDBOpt       {a_PresentDBOpt}
     ,PriorDBOpt         {a_PresentDBOpt}
-    ,AnnChgPol          {a_AnnChgPol}
-    ,MlyChgPol          {a_MlyChgPol}
-    ,MlyChgSpecAmt      {a_MlyChgSpecAmt}
     ,SpecAmtLoadLimit   {a_SpecAmtLoadLimit}
-    ,MlyChgADD          {a_MlyChgADD}
     ,ADDLimit           {a_ADDLimit}
-    ,LoadTgt            {a_LoadTgt}
-    ,LoadExc            {a_LoadExc}
     ,TargetPremium      {a_TargetPremium}
     ,round_min_premium  {a_round_min_premium}
     ,round_max_premium  {a_round_max_premium}
@@ -199,7 +188,19 @@ Irc7702::Irc7702
         LMI_ASSERT(0.0 == GptLimit  );
         LMI_ASSERT(0.0 == CumPmts   );
         }
-    Init();
+    Init
+        ({a_Qc
+        ,a_GLPic
+        ,a_GSPic
+        ,a_Ig
+        ,a_IntDed
+        ,a_AnnChgPol
+        ,a_MlyChgPol
+        ,a_MlyChgSpecAmt
+        ,a_MlyChgADD
+        ,a_LoadTgt
+        ,a_LoadExc
+        });
 }
 
 /// Destructor.
@@ -383,9 +384,9 @@ double Irc7702::Forceout()
 }
 
 //============================================================================
-void Irc7702::Init()
+void Irc7702::Init(init_rates const& r)
 {
-    Length = lmi::ssize(Qc);
+    Length = lmi::ssize(r.Qc);
     LMI_ASSERT(IssueAge <= EndtAge);
     LMI_ASSERT(            EndtAge <= 100);
     LMI_ASSERT(Length == EndtAge - IssueAge);
@@ -395,18 +396,18 @@ void Irc7702::Init()
     // GLP might be wanted for some purpose in a CVAT product.
     // The extra overhead is not enormous.
 
-    InitCommFns();
+    InitCommFns(r);
     InitCorridor();
-    InitPvVectors(Opt1Int4Pct);
-    InitPvVectors(Opt2Int4Pct);
-    InitPvVectors(Opt1Int6Pct);
+    InitPvVectors(r, Opt1Int4Pct);
+    InitPvVectors(r, Opt2Int4Pct);
+    InitPvVectors(r, Opt1Int6Pct);
     // TODO ?? We can delete the commutation functions here, rather than in
     // the dtor, to save some space. We defer doing so until the
     // program is complete. TAXATION !! It would be better not to use pointers--see header.
 }
 
 //============================================================================
-void Irc7702::InitCommFns()
+void Irc7702::InitCommFns(init_rates const& r)
 {
     std::vector<double> glp_naar_disc_rate;
     std::vector<double> gsp_naar_disc_rate;
@@ -419,28 +420,28 @@ void Irc7702::InitCommFns()
     if(!g_UseIcForIg)
         {
         // if the flag is not set, use guar rates for NAAR discount factor
-        glp_naar_disc_rate = Ig;
-        gsp_naar_disc_rate = Ig;
+        glp_naar_disc_rate = r.Ig;
+        gsp_naar_disc_rate = r.Ig;
         }
-    else if(zero == Ig)
+    else if(zero == r.Ig)
         {
         // if guar rate is zero, we will always use it for the NAAR discount factor
-        glp_naar_disc_rate = Ig;
-        gsp_naar_disc_rate = Ig;
+        glp_naar_disc_rate = r.Ig;
+        gsp_naar_disc_rate = r.Ig;
         }
     else
         {
         // if the flag is true, and the guar rate !=0, use the 7702 rates for
         // the NAAR discount factor
-        glp_naar_disc_rate = GLPic;
-        gsp_naar_disc_rate = GSPic;
+        glp_naar_disc_rate = r.GLPic;
+        gsp_naar_disc_rate = r.GSPic;
         }
 
     // Commutation functions using 4% min i: both options 1 and 2
     CommFns[Opt1Int4Pct].reset
         (new ULCommFns
-            (Qc
-            ,GLPic
+            (r.Qc
+            ,r.GLPic
             ,glp_naar_disc_rate
             ,mce_option1_for_7702
             ,mce_monthly
@@ -450,8 +451,8 @@ void Irc7702::InitCommFns()
 
     CommFns[Opt2Int4Pct].reset
         (new ULCommFns
-            (Qc
-            ,GLPic
+            (r.Qc
+            ,r.GLPic
             ,glp_naar_disc_rate
             ,mce_option2_for_7702
             ,mce_monthly
@@ -462,8 +463,8 @@ void Irc7702::InitCommFns()
     // Commutation functions using 6% min i: always option 1
     CommFns[Opt1Int6Pct].reset
         (new ULCommFns
-            (Qc
-            ,GSPic
+            (r.Qc
+            ,r.GSPic
             ,gsp_naar_disc_rate
             ,mce_option1_for_7702
             ,mce_monthly
@@ -503,7 +504,7 @@ void Irc7702::InitCorridor()
 }
 
 //============================================================================
-void Irc7702::InitPvVectors(EIOBasis const& a_EIOBasis)
+void Irc7702::InitPvVectors(init_rates const& r, EIOBasis const& a_EIOBasis)
 {
     // We may need to recalculate these every year for a
     // survivorship policy, depending on how its account
@@ -516,11 +517,11 @@ void Irc7702::InitPvVectors(EIOBasis const& a_EIOBasis)
     // ET !! std::vector<double> ann_chg_pol = AnnChgPol * comm_fns.aD();
     std::vector<double> ann_chg_pol(Length);
     LMI_ASSERT(Length == lmi::ssize(ann_chg_pol));
-    LMI_ASSERT(Length == lmi::ssize(AnnChgPol));
+    LMI_ASSERT(Length == lmi::ssize(r.AnnChgPol));
     LMI_ASSERT(Length == lmi::ssize(comm_fns.aD()));
     std::transform
-        (AnnChgPol.begin()
-        ,AnnChgPol.end()
+        (r.AnnChgPol.begin()
+        ,r.AnnChgPol.end()
         ,comm_fns.aD().begin()
         ,ann_chg_pol.begin()
         ,std::multiplies<double>()
@@ -529,11 +530,11 @@ void Irc7702::InitPvVectors(EIOBasis const& a_EIOBasis)
     // ET !! std::vector<double> mly_chg_pol = MlyChgPol * drop(comm_fns.kD(), -1);
     std::vector<double> mly_chg_pol(Length);
     LMI_ASSERT(Length == lmi::ssize(mly_chg_pol));
-    LMI_ASSERT(Length == lmi::ssize(MlyChgPol));
+    LMI_ASSERT(Length == lmi::ssize(r.MlyChgPol));
     LMI_ASSERT(Length <= lmi::ssize(comm_fns.kD()));
     std::transform
-        (MlyChgPol.begin()
-        ,MlyChgPol.end()
+        (r.MlyChgPol.begin()
+        ,r.MlyChgPol.end()
 // kD * MlyChg implies k == mly; it would be more general to say
 // "modal" instead. But that's still not perfectly general, because
 // we may need commutation functions on more than one non-annual
@@ -576,11 +577,11 @@ void Irc7702::InitPvVectors(EIOBasis const& a_EIOBasis)
     std::vector<double>& chg_sa = PvChgSpecAmt[a_EIOBasis];
     chg_sa.resize(Length);
     LMI_ASSERT(Length == lmi::ssize(chg_sa));
-    LMI_ASSERT(Length == lmi::ssize(MlyChgSpecAmt));
+    LMI_ASSERT(Length == lmi::ssize(r.MlyChgSpecAmt));
     LMI_ASSERT(Length == lmi::ssize(comm_fns.kD()));
     std::transform
-        (MlyChgSpecAmt.begin()
-        ,MlyChgSpecAmt.end()
+        (r.MlyChgSpecAmt.begin()
+        ,r.MlyChgSpecAmt.end()
         ,comm_fns.kD().begin()
         ,chg_sa.begin()
         ,std::multiplies<double>()
@@ -594,11 +595,11 @@ void Irc7702::InitPvVectors(EIOBasis const& a_EIOBasis)
     std::vector<double>& chg_add = PvChgADD[a_EIOBasis];
     chg_add.resize(Length);
     LMI_ASSERT(Length == lmi::ssize(chg_add));
-    LMI_ASSERT(Length == lmi::ssize(MlyChgADD));
+    LMI_ASSERT(Length == lmi::ssize(r.MlyChgADD));
     LMI_ASSERT(Length == lmi::ssize(comm_fns.kD()));
     std::transform
-        (MlyChgADD.begin()
-        ,MlyChgADD.end()
+        (r.MlyChgADD.begin()
+        ,r.MlyChgADD.end()
         ,comm_fns.kD().begin()
         ,chg_add.begin()
         ,std::multiplies<double>()
@@ -621,7 +622,7 @@ void Irc7702::InitPvVectors(EIOBasis const& a_EIOBasis)
     // ET !! PvNpfSglTgt[a_EIOBasis] = (1.0 - LoadTgt) * comm_fns.aD();
     std::vector<double>& npf_sgl_tgt = PvNpfSglTgt[a_EIOBasis];
 //  LMI_ASSERT(Length == lmi::ssize(npf_sgl_tgt)); // TAXATION !! Expunge if truly unwanted.
-    npf_sgl_tgt = LoadTgt;
+    npf_sgl_tgt = r.LoadTgt;
     LMI_ASSERT(Length == lmi::ssize(npf_sgl_tgt));
     std::transform(npf_sgl_tgt.begin(), npf_sgl_tgt.end(), npf_sgl_tgt.begin()
         ,[](double x) { return 1.0 - x; }
@@ -648,7 +649,7 @@ void Irc7702::InitPvVectors(EIOBasis const& a_EIOBasis)
     // ET !! PvNpfSglExc[a_EIOBasis] = (1.0 - LoadExc) * comm_fns.aD();
     std::vector<double>& npf_sgl_exc = PvNpfSglExc[a_EIOBasis];
 //  LMI_ASSERT(Length == lmi::ssize(npf_sgl_exc)); // TAXATION !! Expunge if truly unwanted.
-    npf_sgl_exc = LoadExc;
+    npf_sgl_exc = r.LoadExc;
     LMI_ASSERT(Length == lmi::ssize(npf_sgl_exc));
     std::transform(npf_sgl_exc.begin(), npf_sgl_exc.end(), npf_sgl_exc.begin()
         ,[](double x) { return 1.0 - x; }
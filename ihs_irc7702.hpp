@@ -27,7 +27,7 @@
 #include "mc_enum_type_enums.hpp"
 #include "round_to.hpp"
 
-#include <memory>                       // unique_ptr
+#include <memory>                       // shared_ptr
 #include <vector>
 
 class ULCommFns;
@@ -89,6 +89,7 @@ class Irc7702 final
         ,double                     a_InforceCumPremsPaid
         // TODO ?? TAXATION !! Perhaps other arguments are needed for inforce.
         );
+    Irc7702(Irc7702 const&) = default;
     ~Irc7702();
 
     void Initialize7702
@@ -139,7 +140,6 @@ class Irc7702 final
     double premiums_paid() const;
 
   private:
-    Irc7702(Irc7702 const&) = delete;
     Irc7702& operator=(Irc7702 const&) = delete;
 
     // Interest and DB Option basis
@@ -150,10 +150,29 @@ class Irc7702 final
         ,NumIOBases
         };
 
-    void Init();
-    void InitCommFns();
+    // Rates that only the ctor reads. They're passed to the Init-
+    // functions rather than kept as reference members, so that a copy
+    // (as made for a projection checkpoint) can't refer to vectors
+    // that belong to the original's owner.
+    struct init_rates
+        {
+        std::vector<double> const& Qc;         // 7702 mortality rate
+        std::vector<double> const& GLPic;      // 7702 GLP interest rate
+        std::vector<double> const& GSPic;      // 7702 GSP interest rate
+        std::vector<double> const& Ig;         // Death benefit discount rate
+        std::vector<double> const& IntDed;     // Deduction from interest rate
+        std::vector<double> const& AnnChgPol;  // Annual charge per policy
+        std::vector<double> const& MlyChgPol;  // Monthly charge per policy
+        std::vector<double> const& MlyChgSpecAmt;  // Monthly charge per $1 spec amt
+        std::vector<double> const& MlyChgADD;  // Monthly charge for ADD
+        std::vector<double> const& LoadTgt;    // Premium load up to target
+        std::vector<double> const& LoadExc;    // Premium load on excess over target
+        };
+
+    void Init(init_rates const&);
+    void InitCommFns(init_rates const&);
     void InitCorridor();
-    void InitPvVectors(EIOBasis const& a_EIOBasis);
+    void InitPvVectors(init_rates const&, EIOBasis const& a_EIOBasis);
 
     double CalculatePremium
         (EIOBasis const&            a_EIOBasis
@@ -175,12 +194,6 @@ class Irc7702 final
     int const                  IssueAge;   // Issue age
     int const                  EndtAge;    // Endowment age
 
-    std::vector<double> const& Qc;         // 7702 mortality rate
-    std::vector<double> const& GLPic;      // 7702 GLP interest rate
-    std::vector<double> const& GSPic;      // 7702 GSP interest rate
-    std::vector<double> const& Ig;         // Death benefit discount rate
-    std::vector<double> const& IntDed;     // Deduction from interest rate
-
     double                     PresentBftAmt;
     double                     PriorBftAmt;
     double                     PresentSpecAmt;
@@ -189,15 +202,9 @@ class Irc7702 final
     mcenum_dbopt_7702          PresentDBOpt;   // Present death benefit option
     mcenum_dbopt_7702          PriorDBOpt;     // Prior death benefit option
 
-    std::vector<double> const& AnnChgPol;  // Annual charge per policy
-    std::vector<double> const& MlyChgPol;  // Monthly charge per policy
-    std::vector<double> const& MlyChgSpecAmt;  // Monthly charge per $1 spec amt
     double const               SpecAmtLoadLimit;   // Max spec amt charge base
-    std::vector<double> const& MlyChgADD;  // Monthly charge for ADD
     double const               ADDLimit;   // Max spec amt for ADD charge
 
-    std::vector<double> const& LoadTgt;    // Premium load up to target
-    std::vector<double> const& LoadExc;    // Premium load on excess over target
     double                     TargetPremium;
 
     round_to<double>           round_min_premium;
@@ -229,7 +236,7 @@ class Irc7702 final
 // doesn't matter anymore. TAXATION !! Don't do that then.
 //
 // TODO ?? TAXATION !! Consider using std::vector instead of array members.
-    std::unique_ptr<ULCommFns> CommFns         [NumIOBases];
+    std::shared_ptr<ULCommFns> CommFns         [NumIOBases];
     // After the Init- functions have executed, we can delete the
     // rather sizeable ULCommFns objects, as long as we keep the
     // endowment-year value of D for each basis. TAXATION !! But
@@ -26,11 +26,79 @@
 #include "alert.hpp"
 #include "assert_lmi.hpp"
 #include "basic_values.hpp"
+#include "calendar_date.hpp"            // duration_ceiling()
 #include "et_vector.hpp"
 #include "math_functions.hpp"           // assign_midpoint()
 #include "oecumenic_enumerations.hpp"
+#include "weak_cache.hpp"
+#include "yare_input.hpp"
 
 #include <algorithm>                    // min()
+#include <string>
+#include <tuple>
+
+namespace
+{
+/// Everything that determines the value of a MortalityRates instance.
+///
+/// The first group of elements selects the product database and the
+/// tables read from it. The second governs blending of those tables.
+/// The third comprises per-cell adjustments. They cannot simply
+/// be applied to a shared, unadjusted instance, because multipliers
+/// are applied before annual rates are converted to monthly, and the
+/// results are rounded thereafter; so they must form part of the key.
+/// For a uniform group case, they're typically identical anyway. The
+/// last element governs inforce reentry into select-and-ultimate
+/// current COI tables: see MortalityRates::inforce_reentry_key().
+
+using mortality_rates_key = std::tuple
+    <std::string            // ProductName
+    ,mcenum_gender          // Gender
+    ,mcenum_class           // UnderwritingClass
+    ,mcenum_smoking         // Smoking
+    ,int                    // IssueAge
+    ,mcenum_uw_basis        // GroupUnderwritingType
+    ,mcenum_state           // StateOfJurisdiction
+    ,bool                   // BlendGender
+    ,bool                   // BlendSmoking
+    ,double                 // MaleProportion
+    ,double                 // NonsmokerProportion
+    ,int                    // SpouseIssueAge
+    ,mcenum_table_rating    // SubstandardTable
+    ,double                 // CountryCoiMultiplier
+    ,std::vector<double>    // CurrentCoiMultiplier
+    ,std::vector<double>    // FlatExtra
+    ,std::vector<double>    // PartialMortalityMultiplier
+    ,std::tuple<e_actuarial_table_method,int,int> // Inforce reentry
+    >;
+
+mortality_rates_key key_of
+    (yare_input const&                                   z
+    ,std::tuple<e_actuarial_table_method,int,int> const& inforce_reentry
+    )
+{
+    return mortality_rates_key
+        (z.ProductName
+        ,z.Gender
+        ,z.UnderwritingClass
+        ,z.Smoking
+        ,z.IssueAge
+        ,z.GroupUnderwritingType
+        ,z.StateOfJurisdiction
+        ,z.BlendGender
+        ,z.BlendSmoking
+        ,z.MaleProportion
+        ,z.NonsmokerProportion
+        ,z.SpouseIssueAge
+        ,z.SubstandardTable
+        ,z.CountryCoiMultiplier
+        ,z.CurrentCoiMultiplier
+        ,z.FlatExtra
+        ,z.PartialMortalityMultiplier
+        ,inforce_reentry
+        );
+}
+} // Unnamed namespace.
 
 //============================================================================
 MortalityRates::MortalityRates(BasicValues const& basic_values)
@@ -41,6 +109,57 @@ MortalityRates::MortalityRates(BasicValues const& basic_values)
     initialize();
 }
 
+/// Return an instance shared with any other live cell of the same key.
+///
+/// See class weak_cache for the sharing policy.
+
+std::shared_ptr<MortalityRates> MortalityRates::shared_instance
+    (BasicValues const& basic_values
+    )
+{
+    yare_input const& z = basic_values.yare_input_;
+    static weak_cache<mortality_rates_key,MortalityRates> cache;
+    return cache.retrieve_or_make
+        (key_of
+            (z
+            ,inforce_reentry_key
+                (basic_values.coi_inforce_reentry()
+                ,z.InforceYear
+                ,z.EffectiveDate
+                ,z.LastCoiReentryDate
+                )
+            )
+        ,[&basic_values] {return std::make_shared<MortalityRates>(basic_values);}
+        );
+}
+
+/// Inforce data that current COI rates depend upon.
+///
+/// If the product reenters select-and-ultimate tables for inforce
+/// contracts, current COI rates depend on the inforce year and on
+/// the duration since the last reentry date: see
+/// BasicValues::GetActuarialTable(). Otherwise they don't, and the
+/// neutral values returned let otherwise-identical inforce cells
+/// share an instance.
+
+std::tuple<e_actuarial_table_method,int,int> MortalityRates::inforce_reentry_key
+    (e_actuarial_table_method method
+    ,int                      inforce_year
+    ,calendar_date const&     effective_date
+    ,calendar_date const&     last_reentry_date
+    )
+{
+    if(e_reenter_never == method)
+        {
+        return {e_reenter_never, 0, 0};
+        }
+    return
+        {method
+        ,inforce_year
+        ,duration_ceiling(effective_date, last_reentry_date)
+        };
+}
+
 //============================================================================
 void MortalityRates::reserve_vectors()
 {
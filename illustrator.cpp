@@ -23,6 +23,7 @@
 
 #include "illustrator.hpp"
 
+#include "account_value.hpp"            // first_affected_year()
 #include "alert.hpp"
 #include "assert_lmi.hpp"
 #include "configurable_settings.hpp"
@@ -32,23 +33,34 @@
 #include "group_values.hpp"
 #include "handle_exceptions.hpp"        // report_exception()
 #include "input.hpp"
+#include "ledger.hpp"
 #include "ledgervalues.hpp"
+#include "miscellany.hpp"               // ios_out_trunc_binary()
 #include "multiple_cell_document.hpp"
-#include "path_utility.hpp"             // fs::path inserter
+#include "path_utility.hpp"             // fs::path inserter, unique_filepath()
 #include "platform_dependent.hpp"       // access()
 #include "single_cell_document.hpp"
+#include "solve_statistics.hpp"
 #include "timer.hpp"
+#include "yare_input.hpp"
 
 #include <boost/filesystem/convenience.hpp>
+#include <boost/filesystem/fstream.hpp>
 
 #include <iostream>
 #include <string>
+#include <vector>
 
 illustrator::illustrator(mcenum_emission emission)
     :emission_                 {emission}
     ,seconds_for_input_        {0.0}
     ,seconds_for_calculations_ {0.0}
     ,seconds_for_output_       {0.0}
+    ,checkpoint_interval_      {0}
+    ,verify_incremental_reruns_{false}
+    ,concurrent_bases_         {false}
+    ,secant_solves_            {false}
+    ,concurrent_census_input_  {false}
 {
 }
 
@@ -58,10 +70,14 @@ bool illustrator::operator()(fs::path const& file_path)
     if(".cns" == extension)
         {
         Timer timer;
+        std::vector<yare_input> cells;
+        {
         multiple_cell_document doc(file_path.string());
         test_census_consensus(emission_, doc.case_parms()[0], doc.cell_parms());
+        cells = yare_cells(doc.cell_parms(), concurrent_census_input_);
+        }
         seconds_for_input_ = timer.stop().elapsed_seconds();
-        return operator()(file_path, doc.cell_parms());
+        return operator()(file_path, cells);
         }
     else if(".ill" == extension)
         {
@@ -77,12 +93,14 @@ bool illustrator::operator()(fs::path const& file_path)
         bool close_when_done = custom_io_0_read(input, file_path.string());
         seconds_for_input_ = timer.stop().elapsed_seconds();
         timer.restart();
+        solve_statistics::instance().clear();
         IllusVal z(file_path.string());
-        z.run(input);
+        calculate(z, file_path, input);
         principal_ledger_ = z.ledger();
         seconds_for_calculations_ = timer.stop().elapsed_seconds();
         seconds_for_output_ = emit_ledger(file_path, *z.ledger(), emission_);
         conditionally_show_timings_on_stdout();
+        conditionally_write_solve_statistics(file_path);
         return close_when_done;
         }
     else if(".inix" == extension)
@@ -92,14 +110,16 @@ bool illustrator::operator()(fs::path const& file_path)
         bool emit_pdf_too = custom_io_1_read(input, file_path.string());
         seconds_for_input_ = timer.stop().elapsed_seconds();
         timer.restart();
+        solve_statistics::instance().clear();
         IllusVal z(file_path.string());
-        z.run(input);
+        calculate(z, file_path, input);
         principal_ledger_ = z.ledger();
         seconds_for_calculations_ = timer.stop().elapsed_seconds();
         mcenum_emission x = emit_pdf_too ? mce_emit_pdf_file : mce_emit_nothing;
         mcenum_emission y = static_cast<mcenum_emission>(x | emission_);
         seconds_for_output_ = emit_ledger(file_path, *z.ledger(), y);
         conditionally_show_timings_on_stdout();
+        conditionally_write_solve_statistics(file_path);
         return true;
         }
     else
@@ -119,27 +139,170 @@ bool illustrator::operator()(fs::path const& file_path)
 bool illustrator::operator()(fs::path const& file_path, Input const& z)
 {
     Timer timer;
+    solve_statistics::instance().clear();
     IllusVal IV(file_path.string());
-    IV.run(z);
+    calculate(IV, file_path, z);
     principal_ledger_ = IV.ledger();
     seconds_for_calculations_ = timer.stop().elapsed_seconds();
     seconds_for_output_ = emit_ledger(file_path, *IV.ledger(), emission_);
     conditionally_show_timings_on_stdout();
+    conditionally_write_solve_statistics(file_path);
     return true;
 }
 
 bool illustrator::operator()(fs::path const& file_path, std::vector<Input> const& z)
+{
+    return operator()(file_path, yare_cells(z, false));
+}
+
+/// Run a census in the compact form that calculations use.
+///
+/// A census file's Input objects are converted by yare_cells() and
+/// destroyed before its cells are calculated, so that the run holds
+/// only the compact form. Both forms are held together while they are
+/// converted, though, so peak memory during input is slightly higher
+/// than if Input objects alone were held.
+
+bool illustrator::operator()(fs::path const& file_path, std::vector<yare_input> const& z)
 {
     census_run_result result;
     run_census runner;
+    solve_statistics::instance().clear();
     result = runner(file_path, emission_, z);
     principal_ledger_ = runner.composite();
     seconds_for_calculations_ = result.seconds_for_calculations_;
     seconds_for_output_       = result.seconds_for_output_      ;
     conditionally_show_timings_on_stdout();
+    conditionally_write_solve_statistics(file_path);
     return result.completed_normally_;
 }
 
+/// Change the emission for subsequent illustrations.
+///
+/// Checkpoints are kept, so that a resident server can honor each
+/// request's own emission and still resume from checkpoints taken
+/// by an earlier request.
+
+void illustrator::set_emission(mcenum_emission emission)
+{
+    emission_ = emission;
+}
+
+/// Opt in to incremental re-runs of single-cell illustrations.
+///
+/// A full calculation then takes a checkpoint at each policy year
+/// that is a multiple of the given interval. A later calculation of
+/// a what-if variation, whose input differs only in transactions
+/// beginning at some year (see first_affected_year()), resumes from
+/// the latest checkpoint no later than that year. Otherwise, it's
+/// calculated in full, and its checkpoints replace the old ones.
+/// Nonpositive values (the default) opt out and discard checkpoints.
+
+void illustrator::set_checkpoint_interval(int years)
+{
+    checkpoint_interval_ = years;
+    checkpoints_.clear();
+    checkpoint_input_.reset();
+}
+
+/// Check each incremental re-run against a full calculation.
+///
+/// If their ledgers differ, signal an error. This is intended for
+/// testing: it costs more than calculating in full.
+
+void illustrator::set_verify_incremental_reruns(bool z)
+{
+    verify_incremental_reruns_ = z;
+}
+
+/// Run each cell's bases concurrently.
+///
+/// See AccountValue::set_concurrent_bases(). This affects only cells
+/// calculated individually, not censuses.
+
+void illustrator::set_concurrent_bases(bool z)
+{
+    concurrent_bases_ = z;
+}
+
+/// Solve each cell by secants where that's likely to help.
+///
+/// See AccountValue::set_secant_solves(). Like set_concurrent_bases(),
+/// this affects only cells calculated individually, not censuses.
+
+void illustrator::set_secant_solves(bool z)
+{
+    secant_solves_ = z;
+}
+
+/// Convert a census file's cells concurrently: see yare_cells().
+///
+/// Only command-line programs should use this, because alerts raised
+/// in other threads must not reach a GUI.
+
+void illustrator::set_concurrent_census_input(bool z)
+{
+    concurrent_census_input_ = z;
+}
+
+void illustrator::calculate
+    (IllusVal&       z
+    ,fs::path const& file_path
+    ,Input    const& input
+    )
+{
+    std::shared_ptr<projection_checkpoint const> checkpoint;
+    if(checkpoint_input_)
+        {
+        int const year = first_affected_year(*checkpoint_input_, input);
+        for(auto const& i : checkpoints_)
+            {
+            if(i->year() <= year)
+                {
+                checkpoint = i;
+                }
+            }
+        }
+
+    z.set_concurrent_bases(concurrent_bases_);
+    z.set_secant_solves(secant_solves_);
+    if(!checkpoint)
+        {
+        z.set_checkpoint_interval(checkpoint_interval_);
+        z.run(input);
+        if(0 < checkpoint_interval_)
+            {
+            checkpoints_ = z.checkpoints();
+            checkpoint_input_ = std::make_shared<Input const>(input);
+            }
+        return;
+        }
+
+    z.resume(input, *checkpoint);
+    if(verify_incremental_reruns_)
+        {
+        IllusVal full(file_path.string());
+        full.run(input);
+        unsigned int const expected = full.ledger()->CalculateCRC();
+        unsigned int const observed = z   .ledger()->CalculateCRC();
+        if(expected != observed)
+            {
+            alarum()
+                << "Resuming '"
+                << file_path
+                << "' from year "
+                << checkpoint->year()
+                << " produced CRC "
+                << observed
+                << ", but a full calculation produced CRC "
+                << expected
+                << "."
+                << LMI_FLUSH
+                ;
+            }
+        }
+}
+
 void illustrator::conditionally_show_timings_on_stdout() const
 {
     if(mce_emit_timings & emission_)
@@ -153,6 +316,29 @@ void illustrator::conditionally_show_timings_on_stdout() const
             << Timer::elapsed_msec_str(seconds_for_output_)
             << '\n'
             ;
+        solve_statistics::instance().write_summary(std::cout);
+        }
+}
+
+/// Write statistics for each solve to a tab-delimited file.
+///
+/// Statistics are written only along with timings, and only if any
+/// solve was performed. They cover all cells of a census.
+
+void illustrator::conditionally_write_solve_statistics
+    (fs::path const& file_path
+    ) const
+{
+    solve_statistics const& s = solve_statistics::instance();
+    if((mce_emit_timings & emission_) && !s.records().empty())
+        {
+        configurable_settings const& c = configurable_settings::instance();
+        fs::path const f(modify_directory(file_path, c.print_directory()));
+        fs::ofstream ofs
+            (unique_filepath(f, ".solves" + c.spreadsheet_file_extension())
+            ,ios_out_trunc_binary()
+            );
+        s.write_records(ofs);
         }
 }
 
@@ -32,8 +32,11 @@
 #include <memory>                       // shared_ptr
 #include <vector>
 
+class IllusVal;
 class Input;
 class Ledger;
+class projection_checkpoint;
+class yare_input;
 
 /// Sole top-level facility for illustration generation.
 ///
@@ -48,9 +51,17 @@ class LMI_SO illustrator final
     bool operator()(fs::path const&);
     bool operator()(fs::path const&, Input const&);
     bool operator()(fs::path const&, std::vector<Input> const&);
+    bool operator()(fs::path const&, std::vector<yare_input> const&);
 
     void conditionally_show_timings_on_stdout() const;
 
+    void set_emission(mcenum_emission);
+    void set_checkpoint_interval(int);
+    void set_verify_incremental_reruns(bool);
+    void set_concurrent_bases(bool);
+    void set_secant_solves(bool);
+    void set_concurrent_census_input(bool);
+
     std::shared_ptr<Ledger const> principal_ledger() const;
 
     double seconds_for_input       () const;
@@ -58,11 +69,21 @@ class LMI_SO illustrator final
     double seconds_for_output      () const;
 
   private:
+    void calculate(IllusVal&, fs::path const&, Input const&);
+    void conditionally_write_solve_statistics(fs::path const&) const;
+
     mcenum_emission emission_;
     std::shared_ptr<Ledger const> principal_ledger_;
     double seconds_for_input_;
     double seconds_for_calculations_;
     double seconds_for_output_;
+    int checkpoint_interval_;
+    bool verify_incremental_reruns_;
+    bool concurrent_bases_;
+    bool secant_solves_;
+    bool concurrent_census_input_;
+    std::vector<std::shared_ptr<projection_checkpoint const>> checkpoints_;
+    std::shared_ptr<Input const> checkpoint_input_;
 };
 
 LMI_SO Input const& default_cell();
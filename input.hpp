@@ -42,7 +42,7 @@ class product_database;
 
 #include <iosfwd>                       // ostream
 #include <map>
-#include <memory>                       // unique_ptr
+#include <memory>                       // shared_ptr
 #include <string>
 #include <vector>
 
@@ -217,7 +217,7 @@ class LMI_SO Input final
 
     void make_term_rider_consistent(bool aggressively = true);
 
-    std::unique_ptr<product_database> database_;
+    std::shared_ptr<product_database const> database_;
 
     // Database axes are independent variables; they're "cached" along
     // with the database, which is reset when any of them changes.
@@ -32,8 +32,11 @@
 #include "global_settings.hpp"
 #include "input_sequence.hpp"
 #include "mc_enum_types_aux.hpp"        // is_subject_to_ill_reg(), is_three_rate_finra()
+#include "weak_cache.hpp"
 
 #include <algorithm>                    // min(), max()
+#include <memory>                       // make_shared()
+#include <tuple>
 #include <utility>                      // pair
 
 // Harmonization is physically separated for no better reason than to
@@ -47,12 +50,33 @@ namespace
         database.query_into(DB_MaxGenAcctRate, z);
         return canonicalized_input_sequence(z);
         }
+
+    /// Everything that determines a product_database instance.
+
+    using database_key = std::tuple
+        <std::string            // ProductName
+        ,mcenum_gender          // Gender
+        ,mcenum_class           // UnderwritingClass
+        ,mcenum_smoking         // Smoking
+        ,int                    // IssueAge
+        ,mcenum_uw_basis        // GroupUnderwritingType
+        ,mcenum_state           // StateOfJurisdiction
+        >;
 } // Unnamed namespace.
 
 /// Implementation notes: DoAdaptExternalities().
 ///
 /// Reset database_ if necessary, i.e., if the product or any database
 /// axis changed.
+///
+/// The database is immutable, so every Input with the same product
+/// and axes shares one instance: a census of many cells holds only
+/// as many databases as it has distinct keys, and copying an Input
+/// constructs none. See class weak_cache for the sharing policy. A
+/// consequence is that a change to a product file doesn't affect
+/// input harmonization until no Input that uses it remains; but
+/// calculations are unaffected, because class BasicValues reads its
+/// own product_database.
 
 void Input::DoAdaptExternalities()
 {
@@ -81,8 +105,9 @@ void Input::DoAdaptExternalities()
     CachedGroupUnderwritingType_ = GroupUnderwritingType.value();
     CachedStateOfJurisdiction_   = StateOfJurisdiction  .value();
 
-    database_.reset
-        (new product_database
+    static weak_cache<database_key,product_database const> cache;
+    database_ = cache.retrieve_or_make
+        (database_key
             (CachedProductName_
             ,CachedGender_
             ,CachedUnderwritingClass_
@@ -91,6 +116,18 @@ void Input::DoAdaptExternalities()
             ,CachedGroupUnderwritingType_
             ,CachedStateOfJurisdiction_
             )
+        ,[this]
+            {
+            return std::make_shared<product_database const>
+                (CachedProductName_
+                ,CachedGender_
+                ,CachedUnderwritingClass_
+                ,CachedSmoking_
+                ,CachedIssueAge_
+                ,CachedGroupUnderwritingType_
+                ,CachedStateOfJurisdiction_
+                );
+            }
         );
 
     database_->query_into(DB_MaturityAge, GleanedMaturityAge_);
@@ -33,12 +33,36 @@
 #include "value_cast.hpp"
 
 #include <algorithm>                    // fill()
+#include <map>
+#include <mutex>
 #include <sstream>
 #include <stdexcept>
+#include <tuple>
 #include <type_traits>
+#include <utility>                      // move()
 
 namespace
 {
+/// Products of parsing an input sequence, which depend on nothing but
+/// the SequenceParser ctor's arguments.
+
+struct parse_result
+{
+    std::string diagnostics;
+    std::vector<ValueInterval> intervals;
+};
+
+parse_result parse
+    (std::string const&              input_expression
+    ,int                             years_to_maturity
+    ,int                             issue_age
+    ,int                             retirement_age
+    ,int                             inforce_duration
+    ,int                             effective_year
+    ,std::vector<std::string> const& allowed_keywords
+    ,bool                            keywords_only
+    );
+
 void assert_not_insane_or_disordered
     (std::vector<ValueInterval> const& intervals
     ,int                               years_to_maturity
@@ -95,7 +119,7 @@ InputSequence::InputSequence
         || a_keywords_only && contains(a_allowed_keywords, a_default_keyword)
         );
 
-    SequenceParser const parser
+    parse_result const parsed = parse
         (input_expression
         ,a_years_to_maturity
         ,a_issue_age
@@ -106,14 +130,13 @@ InputSequence::InputSequence
         ,a_keywords_only
         );
 
-    std::string const parser_diagnostics = parser.diagnostic_messages();
-    if(!parser_diagnostics.empty())
+    if(!parsed.diagnostics.empty())
         {
-        throw std::runtime_error(parser_diagnostics);
+        throw std::runtime_error(parsed.diagnostics);
         }
 
     fill_interval_gaps
-        (parser.intervals()
+        (parsed.intervals
         ,intervals_
         ,a_years_to_maturity
         ,a_keywords_only
@@ -399,6 +422,89 @@ std::vector<double> const& InputSequence::seriatim_numbers() const
 
 namespace
 {
+/// Parse an input sequence, memoizing the result.
+///
+/// A census typically applies the same few input-sequence expressions
+/// to many cells, and the GUI validates each expression repeatedly as
+/// it is edited, so the same parse is requested again and again. The
+/// parser's products depend only on its ctor arguments, which form
+/// the cache key. The default keyword is used only after parsing, so
+/// it is not part of the key.
+///
+/// The cache is simply emptied whenever it reaches a fixed size--a
+/// simple policy that bounds memory while retaining any realistic
+/// census's working set. Cache access is serialized, but parsing is
+/// not, so that cells may be reconciled concurrently; a result is
+/// therefore returned by value, not by a reference that another
+/// thread might invalidate.
+
+parse_result parse
+    (std::string const&              input_expression
+    ,int                             years_to_maturity
+    ,int                             issue_age
+    ,int                             retirement_age
+    ,int                             inforce_duration
+    ,int                             effective_year
+    ,std::vector<std::string> const& allowed_keywords
+    ,bool                            keywords_only
+    )
+{
+    using key_type = std::tuple
+        <std::string
+        ,int
+        ,int
+        ,int
+        ,int
+        ,int
+        ,std::vector<std::string>
+        ,bool
+        >;
+    static std::map<key_type,parse_result> cache;
+    static constexpr std::size_t maximum_size {4096};
+    static std::mutex mutex;
+
+    key_type key
+        {input_expression
+        ,years_to_maturity
+        ,issue_age
+        ,retirement_age
+        ,inforce_duration
+        ,effective_year
+        ,allowed_keywords
+        ,keywords_only
+        };
+
+    {
+    std::lock_guard<std::mutex> const lock(mutex);
+    auto const i = cache.find(key);
+    if(cache.end() != i)
+        {
+        return i->second;
+        }
+    }
+
+    SequenceParser const parser
+        (input_expression
+        ,years_to_maturity
+        ,issue_age
+        ,retirement_age
+        ,inforce_duration
+        ,effective_year
+        ,allowed_keywords
+        ,keywords_only
+        );
+
+    std::lock_guard<std::mutex> const lock(mutex);
+    if(maximum_size <= cache.size())
+        {
+        cache.clear();
+        }
+    return cache.emplace
+        (std::move(key)
+        ,parse_result {parser.diagnostic_messages(), parser.intervals()}
+        ).first->second;
+}
+
 void assert_not_insane_or_disordered
     (std::vector<ValueInterval> const& intervals
     ,int                               years_to_maturity
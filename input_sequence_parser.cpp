@@ -29,7 +29,10 @@
 
 #include <algorithm>                    // copy()
 #include <cctype>                       // isalnum(), isspace()
+#include <cmath>                        // copysign(), fabs()
+#include <cstdlib>                      // strtod()
 #include <iterator>                     // ostream_iterator
+#include <limits>
 
 SequenceParser::SequenceParser
     (std::string const&              input_expression
@@ -41,7 +44,7 @@ SequenceParser::SequenceParser
     ,std::vector<std::string> const& a_allowed_keywords
     ,bool                            a_keywords_only
     )
-    :input_stream_                  {input_expression}
+    :input_                         {input_expression}
     ,years_to_maturity_             {a_years_to_maturity}
     ,issue_age_                     {a_issue_age}
     ,retirement_age_                {a_retirement_age}
@@ -586,7 +589,7 @@ SequenceParser::token_type SequenceParser::get_token()
     char c = '\0';
     do
         {
-        if(!input_stream_.get(c))
+        if(!get(c))
             {
             // COMPILER !! bc++5.02 puts garbage into 'c': reset to '\0'.
             // I believe [27.6.1.3] doesn't allow the garbage.
@@ -619,17 +622,16 @@ SequenceParser::token_type SequenceParser::get_token()
             {
             // Lookahead is limited to a single character, not because
             // this is an LL(1) grammar (where "1" means one token,
-            // not one character), but rather because a std::istream
-            // is used for convenience, and calling putback() multiple
-            // times may fail. If e.g. '.' or '-' were used elsewhere
-            // as well as in numeric tokens, then that convenience
-            // might be unaffordable.
-            input_stream_.putback(c);
+            // not one character), but rather because the scanner
+            // historically used a std::istream, on which calling
+            // putback() multiple times may fail. If e.g. '.' or '-'
+            // were used elsewhere as well as in numeric tokens, then
+            // that limitation might be unaffordable.
+            putback();
             // Zero-initialize so that parsing can continue with a
             // non-random value in case extraction fails.
             current_number_ = 0.0;
-            input_stream_ >> current_number_;
-            if(input_stream_.fail())
+            if(!extract_number(current_number_))
                 {
                 diagnostics_ << "Invalid number starting with '" << c << "'. ";
                 mark_diagnostic_context();
@@ -647,7 +649,7 @@ SequenceParser::token_type SequenceParser::get_token()
             {
             current_keyword_ = c;
             while
-                (  input_stream_.get(c)
+                (  get(c)
                 && ((is_ok_for_cctype(c) && std::isalnum(c)) || '_' == c)
                 )
                 {
@@ -658,7 +660,7 @@ SequenceParser::token_type SequenceParser::get_token()
                 // implemented the same way anyway.
                 current_keyword_ += c;
                 }
-            input_stream_.putback(c);
+            putback();
             return current_token_type_ = e_keyword;
             }
         default:
@@ -688,11 +690,133 @@ void SequenceParser::mark_diagnostic_context()
     diagnostics_
         << "Current token '"
         << token_type_name(current_token_type_)
-        << "' at position " << input_stream_.tellg()
+        << "' at position " << position()
         << ".\n"
         ;
 }
 
+/// Scan the next character, like std::istream::get(char&).
+///
+/// The scanning functions emulate the std::istringstream that this
+/// class formerly used, so that diagnostics, which report positions,
+/// are unchanged. Once an attempt is made to read beyond the end of
+/// the input, or to extract an invalid number, the input is no longer
+/// ok: nothing more can be read, and the position is reported as -1,
+/// as tellg() would report it for a stream whose failbit is set.
+
+bool SequenceParser::get(char& c)
+{
+    if(!input_ok_ || input_.size() <= cursor_)
+        {
+        input_ok_ = false;
+        return false;
+        }
+    c = input_[cursor_++];
+    return true;
+}
+
+/// Push back the character most recently scanned.
+///
+/// As with std::istream::putback(), this does nothing once the input
+/// is no longer ok.
+
+void SequenceParser::putback()
+{
+    if(input_ok_)
+        {
+        LMI_ASSERT(0 < cursor_);
+        --cursor_;
+        }
+}
+
+/// Extract a floating-point number, like std::istream::operator>>().
+///
+/// The longest prefix that might be a number is consumed, just as
+/// std::num_get would consume it: an optional sign, digits with at
+/// most one decimal point, and an optional exponent with an optional
+/// sign. That prefix is then converted with std::strtod(), which
+/// avoids the buffer overhead of stream extraction. Iff the entire
+/// prefix is not a valid number, the input is no longer ok and zero
+/// is stored. Reaching the end of the input while scanning a valid
+/// number is likewise treated as the stream's eofbit would be.
+///
+/// For out-of-range values, the libstdc++ behavior is reproduced: an
+/// overflow stores the largest finite value of the appropriate sign
+/// and fails, while an underflow succeeds.
+
+bool SequenceParser::extract_number(double& d)
+{
+    auto const size = input_.size();
+    auto const is_digit = [](char c) {return '0' <= c && c <= '9';};
+    auto i = cursor_;
+    bool found_mantissa = false;
+    bool found_decimal  = false;
+    bool found_exponent = false;
+    if(i < size && ('-' == input_[i] || '+' == input_[i]))
+        {
+        ++i;
+        }
+    while(i < size)
+        {
+        char const c = input_[i];
+        if(is_digit(c))
+            {
+            found_mantissa = true;
+            }
+        else if('.' == c && !found_decimal && !found_exponent)
+            {
+            found_decimal = true;
+            }
+        else if(('e' == c || 'E' == c) && !found_exponent && found_mantissa)
+            {
+            found_exponent = true;
+            if(i + 1 < size && ('-' == input_[1 + i] || '+' == input_[1 + i]))
+                {
+                ++i;
+                }
+            }
+        else
+            {
+            break;
+            }
+        ++i;
+        }
+
+    char const* const first = input_.data() + cursor_;
+    char const* const last  = input_.data() + i;
+    cursor_ = i;
+    if(size <= i)
+        {
+        input_ok_ = false;
+        }
+
+    std::string const token(first, last);
+    char* end = nullptr;
+    double const z = std::strtod(token.c_str(), &end);
+    if(token.empty() || end != token.c_str() + token.size())
+        {
+        d = 0.0;
+        input_ok_ = false;
+        return false;
+        }
+    if(std::numeric_limits<double>::max() < std::fabs(z))
+        {
+        d = std::copysign(std::numeric_limits<double>::max(), z);
+        input_ok_ = false;
+        return false;
+        }
+    d = z;
+    return true;
+}
+
+/// Position of the next character to be scanned, or -1 if the input
+/// is no longer ok.
+
+int SequenceParser::position() const
+{
+    return input_ok_ ? static_cast<int>(cursor_) : -1;
+}
+
 /// Extract first substring from a '\n'-delimited exception::what().
 ///
 /// SequenceParser::diagnostic_messages() returns a '\n'-delimited
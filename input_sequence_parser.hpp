@@ -30,6 +30,7 @@
 
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 class SequenceParser final
@@ -90,14 +91,23 @@ class SequenceParser final
     token_type get_token();
     void match(token_type);
 
+    bool get(char&);
+    void putback();
+    bool extract_number(double&);
+    int position() const;
+
     void mark_diagnostic_context();
 
     // Parser products.
     std::string diagnostic_messages_;
     std::vector<ValueInterval> intervals_;
 
-    // Streams for parser input and diagnostic messages.
-    std::istringstream input_stream_;
+    // Parser input, which is scanned in place, and diagnostic stream.
+    // The input is valid only during construction, because the
+    // ctor does all the parsing.
+    std::string_view const input_;
+    std::string_view::size_type cursor_ {0};
+    bool input_ok_                      {true};
     std::ostringstream diagnostics_;
 
     // Copies of ctor args that are identical to class InputSequence's.
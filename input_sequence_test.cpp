@@ -23,7 +23,10 @@
 
 #include "input_sequence.hpp"
 
+#include "input_sequence_parser.hpp"
+#include "miscellany.hpp"                // stifle_warning_for_unused_value()
 #include "test_tools.hpp"
+#include "timer.hpp"
 
 #include <algorithm>
 #include <iterator>                     // ostream_iterator
@@ -32,6 +35,8 @@ class input_sequence_test
 {
   public:
     static void test();
+    static void test_parse_cache();
+    static void assay_speed();
 
   private:
     static void check
@@ -805,9 +810,120 @@ void input_sequence_test::test()
 #endif // defined SHOW_CENSUS_PASTE_TEST_CASES
 }
 
+/// Test memoization of parser products.
+///
+/// Every argument that can affect parsing must distinguish cached
+/// results; the default keyword, which cannot, must not.
+
+void input_sequence_test::test_parse_cache()
+{
+    std::vector<std::string> const k {"a", "b", "c"};
+    std::string const seq("1 [0, retirement); a [retirement, maturity)");
+
+    // Identical arguments yield identical results.
+    InputSequence const s0(seq, 10, 90, 95, 0, 2002, k, false);
+    InputSequence const s1(seq, 10, 90, 95, 0, 2002, k, false);
+    BOOST_TEST(s0.seriatim_numbers()  == s1.seriatim_numbers());
+    BOOST_TEST(s0.seriatim_keywords() == s1.seriatim_keywords());
+
+    // Retirement age is part of the key.
+    InputSequence const s2(seq, 10, 90, 93, 0, 2002, k, false);
+    BOOST_TEST_EQUAL(3, s2.intervals()[0].end_duration);
+    BOOST_TEST_EQUAL(5, s0.intervals()[0].end_duration);
+
+    // So are the allowed keywords: the same expression is valid with
+    // one set and invalid with another, in either order.
+    BOOST_TEST_THROW
+        (InputSequence(seq, 10, 90, 95, 0, 2002, {"b"}, false)
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Expected keyword chosen from [{] b [}]")
+        );
+    InputSequence const s3(seq, 10, 90, 95, 0, 2002, k, false);
+    BOOST_TEST(s0.seriatim_keywords() == s3.seriatim_keywords());
+
+    // Cached diagnostics are thrown as often as they're requested.
+    for(int j = 0; j < 2; ++j)
+        {
+        BOOST_TEST_THROW
+            (InputSequence("1 [2, 1)", 10, 90, 95, 0, 2002, k, false)
+            ,std::runtime_error
+            ,""
+            );
+        }
+
+    // The default keyword affects only gap filling, not parsing.
+    // Here it fills the initial gap; the last interval is extended
+    // to maturity.
+    std::string const f("b [2, 4)");
+    InputSequence const s4(f, 5, 90, 95, 0, 2002, k, true, "a");
+    InputSequence const s5(f, 5, 90, 95, 0, 2002, k, true, "c");
+    std::vector<std::string> const w4 {"a", "a", "b", "b", "b"};
+    std::vector<std::string> const w5 {"c", "c", "b", "b", "b"};
+    BOOST_TEST(w4 == s4.seriatim_keywords());
+    BOOST_TEST(w5 == s5.seriatim_keywords());
+
+    // Numbers are scanned exactly as by std::istream extraction:
+    // the longest prefix that might be a number is consumed, and it
+    // must be valid in its entirety.
+    BOOST_TEST_EQUAL
+        (1.5e3, InputSequence("1.5e3", 1, 90, 95, 0, 2002).seriatim_numbers()[0]);
+    BOOST_TEST_EQUAL
+        (-0.25, InputSequence("-.25", 1, 90, 95, 0, 2002).seriatim_numbers()[0]);
+    BOOST_TEST_THROW
+        (InputSequence("1e", 1, 90, 95, 0, 2002)
+        ,std::runtime_error
+        ,lmi_test::what_regex
+            ("^Invalid number starting with '1'. Current token 'beginning of input'")
+        );
+    BOOST_TEST_THROW
+        (InputSequence("-;", 1, 90, 95, 0, 2002)
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Invalid number starting with '-'.")
+        );
+}
+
+namespace
+{
+std::string const census_expression
+    ("0 [0, 5); 100000 [5, retirement); 50000 [retirement, #10);"
+    " 25000.5 [@75, @80); 1e4 [@80, maturity)"
+    );
+
+void mete_parser()
+{
+    SequenceParser const parser
+        (census_expression, 50, 45, 65, 0, 2020, {}, false);
+    stifle_warning_for_unused_value(parser.intervals());
+}
+
+void mete_sequence()
+{
+    InputSequence const seq
+        (census_expression, 50, 45, 65, 0, 2020);
+    stifle_warning_for_unused_value(seq.seriatim_numbers());
+}
+} // Unnamed namespace.
+
+/// Measure parsing throughput, both directly and as a census uses it.
+///
+/// Constructing an InputSequence repeatedly from the same arguments,
+/// as a census does for many similar cells, reuses a cached parse.
+
+void input_sequence_test::assay_speed()
+{
+    std::cout
+        << "\n  Speed tests:"
+        << "\n    parse            : " << TimeAnAliquot(mete_parser)
+        << "\n    cached sequence  : " << TimeAnAliquot(mete_sequence)
+        << std::endl
+        ;
+}
+
 int test_main(int, char*[])
 {
     input_sequence_test::test();
+    input_sequence_test::test_parse_cache();
+    input_sequence_test::assay_speed();
 
     return EXIT_SUCCESS;
 }
@@ -38,8 +38,10 @@
 #include "miscellany.hpp"
 #include "oecumenic_enumerations.hpp"
 #include "path_utility.hpp"             // initialize_filesystem()
+#include "ssize_lmi.hpp"
 #include "test_tools.hpp"
 #include "timer.hpp"
+#include "value_cast.hpp"
 #include "xml_lmi.hpp"
 
 #include <xmlwrapp/document.h>
@@ -52,6 +54,7 @@
 #include <functional>                   // bind()
 #include <ios>
 #include <string>
+#include <vector>
 
 class input_test
 {
@@ -375,6 +378,32 @@ std::cout << "replica.FundAllocs.size() is " << replica.FundAllocs.size() << '\n
 
     // For now at least, just test that this compiles and runs.
     yare_input y(original);
+
+    // Converting cells concurrently gives the same result, in the
+    // same order, as converting them in series.
+    std::vector<Input> cells(7, original);
+    for(int j = 0; j < lmi::ssize(cells); ++j)
+        {
+        cells[j]["IssueAge"]    = value_cast<std::string>(30 + j);
+        cells[j]["InsuredName"] = "Cell " + value_cast<std::string>(j);
+        }
+    std::vector<yare_input> const series     = yare_cells(cells, false);
+    std::vector<yare_input> const concurrent = yare_cells(cells, true);
+    BOOST_TEST_EQUAL(cells.size(), series    .size());
+    BOOST_TEST_EQUAL(cells.size(), concurrent.size());
+    for(int j = 0; j < lmi::ssize(cells); ++j)
+        {
+        BOOST_TEST_EQUAL(30 + j               , series    [j].IssueAge);
+        BOOST_TEST_EQUAL(30 + j               , concurrent[j].IssueAge);
+        BOOST_TEST_EQUAL(cells[j].InsuredName.value(), concurrent[j].InsuredName);
+        BOOST_TEST(series[j].SeparateAccountRate == concurrent[j].SeparateAccountRate);
+        BOOST_TEST(!concurrent[j].SeparateAccountRate.empty());
+        // run_census relies on this to find each cell's length.
+        BOOST_TEST_EQUAL
+            (Input::consummate(cells[j]).years_to_maturity()
+            ,lmi::ssize(concurrent[j].SpecifiedAmount)
+            );
+        }
 }
 
 void input_test::test_document_classes()
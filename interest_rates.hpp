@@ -140,6 +140,7 @@ class InterestRates
 {
   public:
     InterestRates(BasicValues const&);
+    InterestRates(InterestRates const&) = default;
     ~InterestRates() = default;
 
     std::vector<double> const& MlyGlpRate() const;
@@ -209,7 +210,6 @@ class InterestRates
 
   private:
     InterestRates();
-    InterestRates(InterestRates const&);
     InterestRates& operator=(InterestRates const&);
 
     void Initialize(); // TODO ?? Implementation needs work.
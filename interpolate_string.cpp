@@ -24,10 +24,13 @@
 #include "interpolate_string.hpp"
 
 #include "alert.hpp"
+#include "assert_lmi.hpp"
+#include "bourn_cast.hpp"
 
-#include <cstring>                      // strlen()
+#include <cstring>                      // strstr()
 #include <stack>
 #include <stdexcept>
+#include <utility>                      // move()
 #include <vector>
 
 namespace
@@ -61,24 +64,24 @@ struct section_info
 // The only context we need is the stack of sections entered so far.
 using context = std::stack<section_info, std::vector<section_info>>;
 
-// The real interpolation recursive function, called by the public one to do
-// all the work.
-void do_interpolate_string_in_context
-    (char const* s
-    ,lookup_function const& lookup
-    ,std::string& out
-    ,context& sections
-    ,std::string const& variable_name = std::string()
-    ,int recursion_level = 0
-    )
+using token_kind = interpolation_token::kind;
+
+// Check if the output is currently active or suppressed because we're
+// inside an inactive section.
+bool is_active(context const& sections)
+{
+    return sections.empty() || sections.top().active_;
+}
+
+// Guard against too deep recursion to avoid crashing on code using too
+// many nested expansions (either unintentionally, e.g. due to including a
+// partial from itself, or maliciously).
+//
+// The maximum recursion level is chosen completely arbitrarily, the only
+// criteria are that it shouldn't be too big to crash due to stack overflow
+// before it is reached nor too small to break legitimate use cases.
+void check_recursion_level(int recursion_level, std::string const& variable_name)
 {
-    // Guard against too deep recursion to avoid crashing on code using too
-    // many nested expansions (either unintentionally, e.g. due to including a
-    // partial from itself, or maliciously).
-    //
-    // The maximum recursion level is chosen completely arbitrarily, the only
-    // criteria are that it shouldn't be too big to crash due to stack overflow
-    // before it is reached nor too small to break legitimate use cases.
     if(100 <= recursion_level)
         {
         alarum()
@@ -88,12 +91,220 @@ void do_interpolate_string_in_context
             << std::flush
             ;
         }
+}
+
+void do_interpolate_template_in_context
+    (interpolation_template const& t
+    ,lookup_function const& lookup
+    ,partial_function const& partial
+    ,std::string& out
+    ,context& sections
+    ,std::string const& variable_name
+    ,int recursion_level
+    );
+
+// Interpolate a string that hasn't been compiled, such as the value of
+// a variable. Most such strings contain no interpolations at all, and
+// are simply copied.
+void do_interpolate_string_in_context
+    (char const* s
+    ,lookup_function const& lookup
+    ,partial_function const& partial
+    ,std::string& out
+    ,context& sections
+    ,std::string const& variable_name
+    ,int recursion_level
+    )
+{
+    check_recursion_level(recursion_level, variable_name);
+
+    if(!std::strstr(s, "{{"))
+        {
+        if(is_active(sections))
+            {
+            out += s;
+            }
+        return;
+        }
+
+    do_interpolate_template_in_context
+        (interpolation_template(s)
+        ,lookup
+        ,partial
+        ,out
+        ,sections
+        ,variable_name
+        ,recursion_level
+        );
+}
+
+// The real interpolation recursive function, called by the public one to do
+// all the work.
+void do_interpolate_template_in_context
+    (interpolation_template const& t
+    ,lookup_function const& lookup
+    ,partial_function const& partial
+    ,std::string& out
+    ,context& sections
+    ,std::string const& variable_name
+    ,int recursion_level
+    )
+{
+    check_recursion_level(recursion_level, variable_name);
+
+    for(auto const& i : t.tokens())
+        {
+        std::string const& name = i.text_;
+        switch(i.kind_)
+            {
+            case token_kind::text:
+                if(is_active(sections))
+                    {
+                    out += name;
+                    }
+                break;
+
+            case token_kind::section:
+            case token_kind::inverted_section:
+                {
+                // If we're inside a disabled section, it doesn't
+                // matter whether this one is active or not.
+                bool active = is_active(sections);
+                if(active)
+                    {
+                    auto const value = lookup
+                        (name
+                        ,interpolate_lookup_kind::section
+                        );
+                    if(value == "1")
+                        {
+                        active = true;
+                        }
+                    else if(value == "0")
+                        {
+                        active = false;
+                        }
+                    else
+                        {
+                        alarum()
+                            << "Invalid value '"
+                            << value
+                            << "' of section '"
+                            << name
+                            << "' at position "
+                            << i.position_
+                            << ", only \"0\" or \"1\" allowed"
+                            << std::flush
+                            ;
+                        }
+
+                    if(token_kind::inverted_section == i.kind_)
+                        {
+                        active = !active;
+                        }
+                    }
+
+                sections.emplace(name, active);
+                }
+                break;
+
+            case token_kind::section_end:
+                if(sections.empty())
+                    {
+                    alarum()
+                        << "Unexpected end of section '"
+                        << name
+                        << "' at position "
+                        << i.position_
+                        << " without previous section start"
+                        << std::flush
+                        ;
+                    }
+                if(name != sections.top().name_)
+                    {
+                    alarum()
+                        << "Unexpected end of section '"
+                        << name
+                        << "' at position "
+                        << i.position_
+                        << " while inside the section '"
+                        << sections.top().name_
+                        << "'"
+                        << std::flush
+                        ;
+                    }
+                sections.pop();
+                break;
+
+            case token_kind::partial:
+                if(is_active(sections))
+                    {
+                    if(partial)
+                        {
+                        auto const p = partial(name);
+                        LMI_ASSERT(p);
+                        do_interpolate_template_in_context
+                            (*p
+                            ,lookup
+                            ,partial
+                            ,out
+                            ,sections
+                            ,name
+                            ,recursion_level + 1
+                            );
+                        }
+                    else
+                        {
+                        do_interpolate_string_in_context
+                            (lookup
+                                (name
+                                ,interpolate_lookup_kind::partial
+                                ).c_str()
+                            ,lookup
+                            ,partial
+                            ,out
+                            ,sections
+                            ,name
+                            ,recursion_level + 1
+                            );
+                        }
+                    }
+                break;
+
+            case token_kind::variable:
+                if(is_active(sections))
+                    {
+                    do_interpolate_string_in_context
+                        (lookup
+                            (name
+                            ,interpolate_lookup_kind::variable
+                            ).c_str()
+                        ,lookup
+                        ,partial
+                        ,out
+                        ,sections
+                        ,name
+                        ,recursion_level + 1
+                        );
+                    }
+                break;
+            }
+        }
+}
+
+} // Unnamed namespace.
 
-    // Check if the output is currently active or suppressed because we're
-    // inside an inactive section.
-    auto const is_active = [&sections]()
+interpolation_template::interpolation_template(char const* s)
+{
+    std::string text;
+    auto const add_token = [this, &text](token_kind kind, std::string name, int pos)
         {
-            return sections.empty() || sections.top().active_;
+        if(!text.empty())
+            {
+            tokens_.push_back({token_kind::text, text, 0});
+            text.clear();
+            }
+        tokens_.push_back({kind, std::move(name), pos});
         };
 
     for(char const* p = s; *p; ++p)
@@ -103,7 +314,7 @@ void do_interpolate_string_in_context
         if(p[0] == '{' && p[1] == '{')
             {
             std::string name;
-            auto const pos_start = p - s + 1;
+            int const pos_start = bourn_cast<int>(p - s + 1);
             for(p += 2;; ++p)
                 {
                 if(*p == '\0')
@@ -120,121 +331,27 @@ void do_interpolate_string_in_context
                     switch(name.empty() ? '\0' : name[0])
                         {
                         case '#':
+                            add_token(token_kind::section, name.substr(1), pos_start);
+                            break;
                         case '^':
-                            {
-                            auto const real_name = name.substr(1);
-                            // If we're inside a disabled section, it doesn't
-                            // matter whether this one is active or not.
-                            bool active = is_active();
-                            if(active)
-                                {
-                                auto const value = lookup
-                                    (real_name
-                                    ,interpolate_lookup_kind::section
-                                    );
-                                if(value == "1")
-                                    {
-                                    active = true;
-                                    }
-                                else if(value == "0")
-                                    {
-                                    active = false;
-                                    }
-                                else
-                                    {
-                                    alarum()
-                                        << "Invalid value '"
-                                        << value
-                                        << "' of section '"
-                                        << real_name
-                                        << "' at position "
-                                        << pos_start
-                                        << ", only \"0\" or \"1\" allowed"
-                                        << std::flush
-                                        ;
-                                    }
-
-                                if(name[0] == '^')
-                                    {
-                                    active = !active;
-                                    }
-                                }
-
-                            sections.emplace(real_name, active);
-                            }
+                            add_token(token_kind::inverted_section, name.substr(1), pos_start);
                             break;
-
                         case '/':
-                            if(sections.empty())
-                                {
-                                alarum()
-                                    << "Unexpected end of section '"
-                                    << name.substr(1)
-                                    << "' at position "
-                                    << pos_start
-                                    << " without previous section start"
-                                    << std::flush
-                                    ;
-                                }
-                            if(name.compare(1, std::string::npos, sections.top().name_) != 0)
-                                {
-                                alarum()
-                                    << "Unexpected end of section '"
-                                    << name.substr(1)
-                                    << "' at position "
-                                    << pos_start
-                                    << " while inside the section '"
-                                    << sections.top().name_
-                                    << "'"
-                                    << std::flush
-                                    ;
-                                }
-                            sections.pop();
+                            add_token(token_kind::section_end, name.substr(1), pos_start);
                             break;
-
                         case '>':
-                            if(is_active())
-                                {
-                                auto const& real_name = name.substr(1);
-
-                                do_interpolate_string_in_context
-                                    (lookup
-                                        (real_name
-                                        ,interpolate_lookup_kind::partial
-                                        ).c_str()
-                                    ,lookup
-                                    ,out
-                                    ,sections
-                                    ,real_name
-                                    ,recursion_level + 1
-                                    );
-                                }
+                            add_token(token_kind::partial, name.substr(1), pos_start);
                             break;
-
                         case '!':
                             // This is a comment, we just ignore it completely.
                             break;
-
                         default:
-                            if(is_active())
-                                {
-                                // We don't check here if name is not empty, as
-                                // there is no real reason to do it. Empty
-                                // variable name may seem strange, but why not
-                                // allow using "{{}}" to insert something into
-                                // the interpolated string, after all?
-                                do_interpolate_string_in_context
-                                    (lookup
-                                        (name
-                                        ,interpolate_lookup_kind::variable
-                                        ).c_str()
-                                    ,lookup
-                                    ,out
-                                    ,sections
-                                    ,name
-                                    ,recursion_level + 1
-                                    );
-                                }
+                            // We don't check here if name is not empty, as
+                            // there is no real reason to do it. Empty
+                            // variable name may seem strange, but why not
+                            // allow using "{{}}" to insert something into
+                            // the interpolated string, after all?
+                            add_token(token_kind::variable, name, pos_start);
                         }
 
                     // We consume two characters here ("}}"), not one, as in a
@@ -263,19 +380,31 @@ void do_interpolate_string_in_context
                 name += *p;
                 }
             }
-        else if(is_active())
+        else
             {
-            out += *p;
+            text += *p;
             }
         }
-}
 
-} // Unnamed namespace.
+    if(!text.empty())
+        {
+        tokens_.push_back({token_kind::text, text, 0});
+        }
+}
 
 std::string interpolate_string
     (char const* s
     ,lookup_function const& lookup
     )
+{
+    return interpolate_string(interpolation_template(s), lookup);
+}
+
+std::string interpolate_string
+    (interpolation_template const& t
+    ,lookup_function        const& lookup
+    ,partial_function       const& partial
+    )
 {
     std::string out;
 
@@ -283,12 +412,25 @@ std::string interpolate_string
     // interpolated variables tend to be longer than the variables names
     // themselves, but it's difficult to estimate the resulting string length
     // any better than this.
-    out.reserve(std::strlen(s));
+    std::string::size_type length = 0;
+    for(auto const& i : t.tokens())
+        {
+        length += i.text_.size();
+        }
+    out.reserve(length);
 
     // The stack contains all the sections that we're currently in.
-    std::stack<section_info, std::vector<section_info>> sections;
+    context sections;
 
-    do_interpolate_string_in_context(s, lookup, out, sections);
+    do_interpolate_template_in_context
+        (t
+        ,lookup
+        ,partial
+        ,out
+        ,sections
+        ,std::string()
+        ,0
+        );
 
     if(!sections.empty())
         {
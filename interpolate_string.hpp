@@ -27,7 +27,9 @@
 #include "so_attributes.hpp"
 
 #include <functional>                   // function
+#include <memory>                       // shared_ptr
 #include <string>
+#include <vector>
 
 enum class interpolate_lookup_kind
     {variable
@@ -68,4 +70,69 @@ LMI_SO std::string interpolate_string
     ,lookup_function const& lookup
     );
 
+/// A single element of a compiled template: see interpolation_template.
+
+struct interpolation_token
+{
+    enum class kind
+        {text
+        ,variable
+        ,section
+        ,inverted_section
+        ,section_end
+        ,partial
+        };
+
+    kind        kind_;
+    // Literal text, or the name of a variable, section, or partial,
+    // without any prefix character.
+    std::string text_;
+    // One-based position of the opening braces, for diagnostics.
+    int         position_;
+};
+
+/// Template compiled for repeated interpolation.
+///
+/// Parsing a template yields a list of tokens--literal text,
+/// variables, section boundaries, and partials--so that interpolating
+/// it is just a linear walk over that list. Comments are discarded.
+/// Syntax errors are diagnosed when the template is compiled; errors
+/// that depend on the values looked up (such as mismatched section
+/// boundaries, which may span partials) are diagnosed only when the
+/// template is interpolated.
+
+class LMI_SO interpolation_template final
+{
+  public:
+    explicit interpolation_template(char const*);
+
+    std::vector<interpolation_token> const& tokens() const {return tokens_;}
+
+  private:
+    std::vector<interpolation_token> tokens_;
+};
+
+using partial_function = std::function
+    <std::shared_ptr<interpolation_template const> (std::string const&)>;
+
+/// Interpolate a compiled template.
+///
+/// The result is the same as that of the overload taking a string,
+/// except that partials are obtained by calling the 'partial' function
+/// if it's not empty, so that each partial can be compiled only once
+/// and reused. Otherwise, partials are looked up as text by calling
+/// 'lookup', and compiled every time they are used. A partial is
+/// returned as a shared_ptr, which is held while the partial is
+/// interpolated, so that a cache that returns it may replace it
+/// meanwhile, e.g. because its file has changed.
+///
+/// The values of variables can't be compiled in advance, because they
+/// vary; but a value that contains no "{{" is used without compiling.
+
+LMI_SO std::string interpolate_string
+    (interpolation_template const& t
+    ,lookup_function        const& lookup
+    ,partial_function       const& partial = partial_function()
+    );
+
 #endif // interpolate_string_hpp
@@ -24,8 +24,139 @@
 #include "interpolate_string.hpp"
 
 #include "test_tools.hpp"
+#include "timer.hpp"
 
+#include <iostream>
+#include <map>
+#include <memory>                       // make_shared(), shared_ptr
 #include <stdexcept>
+#include <string>
+
+namespace
+{
+// A page similar to those in the PDF templates: text with a great
+// many variables, partials, and sections.
+
+std::string const page_partial
+    ("<p>{{#has_var}}Variable: {{var}}{{/has_var}}"
+     "{{^has_var}}None{{/has_var}} {{! Comment. }}</p>\n"
+    );
+
+std::string const page
+    ("{{>header}}"
+     "<table>"
+     "{{#has_var}}<tr><td>{{a}}</td><td>{{b}}</td><td>{{c}}</td></tr>{{/has_var}}"
+     "<tr><td>{{d}}</td><td>{{e}}</td><td>{{f[1]}}</td></tr>"
+     "</table>"
+     "{{>paragraph}}{{>paragraph}}{{>paragraph}}{{>paragraph}}"
+     "{{>footer}}"
+    );
+
+std::string page_lookup(std::string const& s, interpolate_lookup_kind kind)
+{
+    if(interpolate_lookup_kind::partial == kind)
+        {
+        if(s == "header") return "<h1>{{title}}</h1>";
+        if(s == "footer") return "<small>{{footnote}}</small>";
+        return page_partial;
+        }
+    if(s == "has_var") return "1";
+    if(s == "footnote") return "Page {{page_number}}";
+    return "value of " + s;
+}
+
+std::shared_ptr<interpolation_template const> page_partials(std::string const& s)
+{
+    static std::map<std::string,std::shared_ptr<interpolation_template const>> cache;
+    auto i = cache.find(s);
+    if(cache.end() == i)
+        {
+        i = cache.emplace
+            (s
+            ,std::make_shared<interpolation_template const>
+                (page_lookup(s, interpolate_lookup_kind::partial).c_str())
+            ).first;
+        }
+    return i->second;
+}
+
+void mete_uncompiled()
+{
+    std::string volatile z = interpolate_string(page.c_str(), page_lookup);
+}
+
+interpolation_template const& compiled_page()
+{
+    static interpolation_template const z(page.c_str());
+    return z;
+}
+
+void mete_compiled()
+{
+    std::string volatile z = interpolate_string
+        (compiled_page()
+        ,page_lookup
+        ,page_partials
+        );
+}
+
+void test_compiled_template()
+{
+    interpolation_template const t(page.c_str());
+    std::string const expected = interpolate_string(page.c_str(), page_lookup);
+    BOOST_TEST_EQUAL(expected, interpolate_string(t, page_lookup));
+    BOOST_TEST_EQUAL(expected, interpolate_string(t, page_lookup, page_partials));
+    // A compiled template can be used repeatedly.
+    BOOST_TEST_EQUAL(expected, interpolate_string(t, page_lookup, page_partials));
+
+    // Comments are discarded, and adjacent text is joined.
+    interpolation_template const c("a{{!x}}b{{y}}");
+    BOOST_TEST_EQUAL(2, c.tokens().size());
+    BOOST_TEST_EQUAL("ab", c.tokens()[0].text_);
+    BOOST_TEST_EQUAL("y" , c.tokens()[1].text_);
+
+    // Syntax errors are diagnosed when a template is compiled.
+    BOOST_TEST_THROW
+        (interpolation_template("{{x")
+        ,std::runtime_error
+        ,lmi_test::what_regex("Unmatched opening brace at position 1")
+        );
+
+    // The partial function is called whenever a partial is used, so
+    // a partial that changes between interpolations is seen anew.
+    std::string version = "1";
+    auto const versioned = [&version] (std::string const&)
+        {
+        return std::make_shared<interpolation_template const>
+            (("v" + version).c_str()
+            );
+        };
+    interpolation_template const v("<{{>p}}>");
+    BOOST_TEST_EQUAL("<v1>", interpolate_string(v, page_lookup, versioned));
+    version = "2";
+    BOOST_TEST_EQUAL("<v2>", interpolate_string(v, page_lookup, versioned));
+
+    // Sections may begin in one template and end in another.
+    BOOST_TEST_EQUAL
+        (interpolate_string
+            (interpolation_template("{{>open}}x{{/s}}y")
+            ,[](std::string const& s, interpolate_lookup_kind) -> std::string
+                {return "s" == s ? "0" : "{{#s}}";}
+            )
+        ,"y"
+        );
+}
+
+void assay_speed()
+{
+    std::cout
+        << "\n  Speed tests:"
+        << "\n    uncompiled: " << TimeAnAliquot(mete_uncompiled)
+        << "\n    compiled  : " << TimeAnAliquot(mete_compiled)
+        << std::endl
+        ;
+}
+} // Unnamed namespace.
 
 int test_main(int, char*[])
 {
@@ -250,5 +381,9 @@ int test_main(int, char*[])
         ,"no such variable 'x'"
         );
 
+    test_compiled_template();
+
+    assay_speed();
+
     return EXIT_SUCCESS;
 }
@@ -21,16 +21,22 @@
 
 #include "pchfile.hpp"
 
+#include "columnar_ledger.hpp"
+#include "global_settings.hpp"
 #include "ledger.hpp"
 #include "ledger_evaluator.hpp"
 #include "ledger_invariant.hpp"
+#include "ledger_text_formats.hpp"     // PrintCellColumnar(), PrintCellTabDelimited()
 #include "ledger_variant.hpp"
 
+#include "miscellany.hpp"               // files_are_identical(), ios_out_trunc_binary()
 #include "path_utility.hpp"             // initialize_filesystem()
 #include "test_tools.hpp"
 #include "timer.hpp"
 
 #include <cstdio>                       // remove()
+#include <fstream>
+#include <vector>
 
 void authenticate_system() {} // Do-nothing stub.
 
@@ -41,12 +47,16 @@ class ledger_test
         {
         test_default_initialization();
         test_evaluator();
+        test_columnar();
+        test_case_files();
         test_speed();
         }
 
   private:
     static void test_default_initialization();
     static void test_evaluator();
+    static void test_columnar();
+    static void test_case_files();
     static void test_speed();
 };
 
@@ -76,6 +86,93 @@ void ledger_test::test_evaluator()
     BOOST_TEST(0 == std::remove("tsv_eraseme.values.tsv"));
 }
 
+void ledger_test::test_columnar()
+{
+    Ledger ledger(100, mce_finra, false, false, false);
+    ledger.ledger_invariant_->SpecAmt.assign(100, 1000000.0);
+    {
+    std::ofstream ofs("eraseme.columnar", ios_out_trunc_binary());
+    columnar_ledger_writer w(ofs);
+    PrintCellColumnar(ledger, w);
+    PrintCellColumnar(ledger, w);
+    }
+
+    columnar_ledger_reader r("eraseme.columnar");
+    BOOST_TEST_EQUAL(2  , r.cells());
+    BOOST_TEST_EQUAL(100, r.length(1));
+    BOOST_TEST_EQUAL("Specified Amount", r.legends()[r.column_index("SpecAmt")]);
+    BOOST_TEST_EQUAL(1000000.0, r.column(1, r.column_index("SpecAmt"))[99]);
+    // Every basis is written, not just those in the calculation summary.
+    r.column_index("AcctVal_Current");
+    r.column_index("AcctVal_Guaranteed");
+    BOOST_TEST(0 == std::remove("eraseme.columnar"));
+}
+
+/// Case-level files written through one stream for a whole run, as
+/// class ledger_emitter writes them, must be byte-for-byte identical
+/// to those written by reopening the file for each cell.
+
+void ledger_test::test_case_files()
+{
+    // Avoid writing today's date, which could change between runs.
+    global_settings::instance().set_regression_testing(true);
+
+    std::vector<Ledger> ledgers;
+    for(int i = 0; i < 3; ++i)
+        {
+        // Cells of different lengths, with different values.
+        Ledger ledger(100 - 10 * i, mce_finra, false, false, false);
+        LedgerInvariant& invar = *ledger.ledger_invariant_;
+        invar.InforceYear = i;
+        invar.Insured1 = "Cell " + std::to_string(i);
+        invar.SpecAmt.assign(invar.GetLength(), 1000000.0 / (1 + i));
+        invar.GrossPmt.assign(invar.GetLength(), 12345.678 * i);
+        ledgers.push_back(ledger);
+        }
+
+    std::remove("eraseme_reopened.tsv");
+    std::remove("eraseme_reopened.roster.tsv");
+    PrintRosterHeaders("eraseme_reopened.roster.tsv");
+    for(auto const& i : ledgers)
+        {
+        PrintCellTabDelimited  (i, "eraseme_reopened.tsv");
+        PrintRosterTabDelimited(i, "eraseme_reopened.roster.tsv");
+        }
+
+    {
+    std::ofstream spreadsheet("eraseme_persistent.tsv", ios_out_trunc_binary());
+    std::ofstream roster("eraseme_persistent.roster.tsv", ios_out_trunc_binary());
+    PrintRosterHeaders(roster);
+    for(auto const& i : ledgers)
+        {
+        PrintCellTabDelimited  (i, spreadsheet);
+        PrintRosterTabDelimited(i, roster);
+        }
+    BOOST_TEST(spreadsheet.good());
+    BOOST_TEST(roster.good());
+    }
+
+    BOOST_TEST
+        (files_are_identical
+            ("eraseme_reopened.tsv"
+            ,"eraseme_persistent.tsv"
+            )
+        );
+    BOOST_TEST
+        (files_are_identical
+            ("eraseme_reopened.roster.tsv"
+            ,"eraseme_persistent.roster.tsv"
+            )
+        );
+
+    BOOST_TEST(0 == std::remove("eraseme_reopened.tsv"));
+    BOOST_TEST(0 == std::remove("eraseme_reopened.roster.tsv"));
+    BOOST_TEST(0 == std::remove("eraseme_persistent.tsv"));
+    BOOST_TEST(0 == std::remove("eraseme_persistent.roster.tsv"));
+
+    global_settings::instance().set_regression_testing(false);
+}
+
 void ledger_test::test_speed()
 {
     Ledger ledger(100, mce_finra, false, false, false);
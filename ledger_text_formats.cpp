@@ -28,6 +28,7 @@
 #include "authenticity.hpp"
 #include "bourn_cast.hpp"
 #include "calendar_date.hpp"
+#include "columnar_ledger.hpp"
 #include "comma_punct.hpp"
 #include "configurable_settings.hpp"    // effective_calculation_summary_columns()
 #include "contains.hpp"
@@ -433,12 +434,31 @@ std::string FormatSelectedValuesAsTsv(Ledger const& ledger_values)
 /// Write ledger to a tab-delimited file suitable for spreadsheets.
 ///
 /// The file is appended to, rather than replaced, so that all cells
-/// in a census can be written to the same file.
+/// in a census can be written to the same file. To write many cells,
+/// it is faster to open the file only once, and call the overload
+/// that writes to a stream for each cell, as class ledger_emitter
+/// does.
 
 void PrintCellTabDelimited
     (Ledger const& ledger_values
     ,std::string const& file_name
     )
+{
+    std::ofstream os(file_name.c_str(), ios_out_app_binary());
+    PrintCellTabDelimited(ledger_values, os);
+    if(!os)
+        {
+        alarum() << "Unable to write '" << file_name << "'." << LMI_FLUSH;
+        }
+}
+
+/// Write ledger to a stream in a tab-delimited format suitable for
+/// spreadsheets.
+
+void PrintCellTabDelimited
+    (Ledger const& ledger_values
+    ,std::ostream& os
+    )
 {
     throw_if_interdicted(ledger_values);
 
@@ -452,8 +472,6 @@ void PrintCellTabDelimited
     LedgerInvariant& unclean = const_cast<LedgerInvariant&>(Invar);
     unclean.CalculateIrrs(ledger_values);
 
-    std::ofstream os(file_name.c_str(), ios_out_app_binary());
-
     os << "\n\nFOR BROKER-DEALER USE ONLY. NOT TO BE SHARED WITH CLIENTS.\n\n";
 
     os << "ContractNumber\t\t"    << Invar.value_str("ContractNumber" ) << '\n';
@@ -646,10 +664,6 @@ void PrintCellTabDelimited
 
         os << '\n';
         }
-    if(!os)
-        {
-        alarum() << "Unable to write '" << file_name << "'." << LMI_FLUSH;
-        }
 }
 
 /// Write group-roster headers to a tab-delimited file suitable for spreadsheets.
@@ -657,7 +671,18 @@ void PrintCellTabDelimited
 void PrintRosterHeaders(std::string const& file_name)
 {
     std::ofstream os(file_name.c_str(), ios_out_app_binary());
+    PrintRosterHeaders(os);
+    if(!os)
+        {
+        alarum() << "Unable to write '" << file_name << "'." << LMI_FLUSH;
+        }
+}
+
+/// Write group-roster headers to a stream in a tab-delimited format
+/// suitable for spreadsheets.
 
+void PrintRosterHeaders(std::ostream& os)
+{
     os << "FOR BROKER-DEALER USE ONLY. NOT TO BE SHARED WITH CLIENTS.\n\n";
 
     // Skip authentication for non-interactive regression testing.
@@ -724,11 +749,6 @@ void PrintRosterHeaders(std::string const& file_name)
         os << i << '\t';
         }
     os << "\n\n";
-
-    if(!os)
-        {
-        alarum() << "Unable to write '" << file_name << "'." << LMI_FLUSH;
-        }
 }
 
 /// Write group roster to a tab-delimited file suitable for spreadsheets.
@@ -740,11 +760,30 @@ void PrintRosterHeaders(std::string const& file_name)
 /// varying issue years, no year in the composite would match the sum
 /// of inforce-year cell values, because the composite is summed by
 /// policy year.
+///
+/// As with PrintCellTabDelimited(), to write many cells, it is faster
+/// to call the overload that writes to a stream.
 
 void PrintRosterTabDelimited
     (Ledger const& ledger_values
     ,std::string const& file_name
     )
+{
+    std::ofstream os(file_name.c_str(), ios_out_app_binary());
+    PrintRosterTabDelimited(ledger_values, os);
+    if(!os)
+        {
+        alarum() << "Unable to write '" << file_name << "'." << LMI_FLUSH;
+        }
+}
+
+/// Write group roster to a stream in a tab-delimited format suitable
+/// for spreadsheets.
+
+void PrintRosterTabDelimited
+    (Ledger const& ledger_values
+    ,std::ostream& os
+    )
 {
     if(ledger_values.is_composite())
         {
@@ -754,8 +793,6 @@ void PrintRosterTabDelimited
     LedgerInvariant const& Invar = ledger_values.GetLedgerInvariant();
     LedgerVariant   const& Curr_ = ledger_values.GetCurrFull();
 
-    std::ofstream os(file_name.c_str(), ios_out_app_binary());
-
     int d = static_cast<int>(Invar.InforceYear);
     LMI_ASSERT(d < Invar.GetLength());
     LMI_ASSERT(d < Curr_.GetLength());
@@ -803,11 +840,71 @@ void PrintRosterTabDelimited
         << Invar.value_str("SpouseRiderAmount"      ) << '\t'
         << '\n'
         ;
+}
 
-    if(!os)
+namespace
+{
+/// Suffix distinguishing a variant vector's basis, as in
+/// numeric_vector() and ledger_evaluator.
+
+std::string basis_suffix(mcenum_run_basis b)
+{
+    switch(b)
         {
-        alarum() << "Unable to write '" << file_name << "'." << LMI_FLUSH;
+        case mce_run_gen_curr_sep_full: return "_Current";
+        case mce_run_gen_guar_sep_full: return "_Guaranteed";
+        case mce_run_gen_mdpt_sep_full: return "_Midpoint";
+        case mce_run_gen_curr_sep_zero: return "_CurrentZero";
+        case mce_run_gen_guar_sep_zero: return "_GuaranteedZero";
+        case mce_run_gen_curr_sep_half: return "_CurrentHalf";
+        case mce_run_gen_guar_sep_half: return "_GuaranteedHalf";
         }
+    throw "Unreachable--silences a compiler diagnostic.";
+}
+} // Unnamed namespace.
+
+/// Append all numeric vectors to a columnar ledger file.
+///
+/// Columns are the invariant ledger's vectors, then 'InforceLives',
+/// then each basis's variant vectors, named as in numeric_vector().
+/// Legends are taken from ledger_metadata_map() where it has them.
+/// All cells of a case share the same columns because they share
+/// the same bases, so the whole case can be written to one file.
+///
+/// 'InforceLives' has one more element than other vectors; the last,
+/// which represents lives at the end of the final year, is omitted.
+
+void PrintCellColumnar
+    (Ledger const&           ledger_values
+    ,columnar_ledger_writer& writer
+    )
+{
+    std::map<std::string,ledger_metadata> const& metadata = ledger_metadata_map();
+    std::vector<columnar_ledger_column> columns;
+    auto add = [&](std::string const& name, std::vector<double> const* v)
+        {
+        auto const i = metadata.find(name);
+        std::string const legend = metadata.end() == i ? "" : i->second.legend_;
+        columns.push_back({name, legend, v});
+        };
+
+    LedgerInvariant const& invar = ledger_values.GetLedgerInvariant();
+    for(auto const& i : invar.all_vectors())
+        {
+        add(i.first, i.second);
+        }
+    add("InforceLives", &invar.GetInforceLives());
+    for(auto const& b : ledger_values.GetRunBases())
+        {
+        std::string const suffix = basis_suffix(b);
+        LedgerVariant const& var = map_lookup(ledger_values.GetLedgerMap().held(), b);
+        for(auto const& i : var.all_vectors())
+            {
+            add(i.first + suffix, i.second);
+            }
+        }
+
+    writer.append(columns, invar.GetLength(), ledger_values.is_composite());
 }
 
 class FlatTextLedgerPrinter final
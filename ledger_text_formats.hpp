@@ -33,14 +33,20 @@
 #include <vector>
 
 class Ledger;
+class columnar_ledger_writer;
 
 LMI_SO std::string FormatSelectedValuesAsHtml(Ledger const&);
 LMI_SO std::string FormatSelectedValuesAsTsv (Ledger const&);
 
 LMI_SO void PrintCellTabDelimited  (Ledger const&, std::string const& file_name);
+LMI_SO void PrintCellTabDelimited  (Ledger const&, std::ostream&);
 
 LMI_SO void PrintRosterHeaders     (               std::string const& file_name);
+LMI_SO void PrintRosterHeaders     (               std::ostream&);
 LMI_SO void PrintRosterTabDelimited(Ledger const&, std::string const& file_name);
+LMI_SO void PrintRosterTabDelimited(Ledger const&, std::ostream&);
+
+LMI_SO void PrintCellColumnar      (Ledger const&, columnar_ledger_writer&);
 
 LMI_SO void PrintLedgerFlatText    (Ledger const&, std::ostream&);
 
@@ -28,6 +28,7 @@
 #include "fenv_guard.hpp"
 #include "input.hpp"
 #include "ledger.hpp"
+#include "yare_input.hpp"
 
 IllusVal::IllusVal(std::string const& filename)
     :filename_ {filename}
@@ -37,15 +38,76 @@ IllusVal::IllusVal(std::string const& filename)
 double IllusVal::run(Input const& input)
 {
     fenv_guard fg;
-    AccountValue av(input);
+    return run(yare_input(Input::consummate(input)));
+}
+
+/// Like run(Input const&), but for input already consummated.
+
+double IllusVal::run(yare_input const& consummated_input)
+{
+    fenv_guard fg;
+    AccountValue av(consummated_input);
     av.SetDebugFilename(filename_);
+    av.set_checkpoint_interval(checkpoint_interval_);
+    av.set_concurrent_bases(concurrent_bases_);
+    av.set_secant_solves(secant_solves_);
 
     double z = av.RunAV();
     ledger_ = av.ledger_from_av();
+    checkpoints_ = av.checkpoints();
+
+    return z;
+}
+
+/// Like run(), but resume from a checkpoint taken by run().
+///
+/// See AccountValue::ResumeAV() for the inputs that may differ.
+
+double IllusVal::resume(Input const& input, projection_checkpoint const& cp)
+{
+    fenv_guard fg;
+    AccountValue av(input);
+    av.SetDebugFilename(filename_);
+    av.set_concurrent_bases(concurrent_bases_);
+
+    double z = av.ResumeAV(cp);
+    ledger_ = av.ledger_from_av();
 
     return z;
 }
 
+/// Make run() take checkpoints: see AccountValue::set_checkpoint_interval().
+
+void IllusVal::set_checkpoint_interval(int years)
+{
+    checkpoint_interval_ = years;
+}
+
+/// Checkpoints taken by the last call to run(), in year order.
+
+std::vector<std::shared_ptr<projection_checkpoint const>> const& IllusVal::checkpoints() const
+{
+    return checkpoints_;
+}
+
+/// Make run() and resume() run bases concurrently.
+///
+/// See AccountValue::set_concurrent_bases().
+
+void IllusVal::set_concurrent_bases(bool z)
+{
+    concurrent_bases_ = z;
+}
+
+/// Make run() solve by secants where that's likely to help.
+///
+/// See AccountValue::set_secant_solves().
+
+void IllusVal::set_secant_solves(bool z)
+{
+    secant_solves_ = z;
+}
+
 std::shared_ptr<Ledger const> IllusVal::ledger() const
 {
     LMI_ASSERT(ledger_.get());
@@ -28,9 +28,12 @@
 
 #include <memory>                       // shared_ptr
 #include <string>
+#include <vector>
 
 class Input;
 class Ledger;
+class projection_checkpoint;
+class yare_input;
 
 /// Run an individual illustration, producing a ledger.
 ///
@@ -43,6 +46,14 @@ class IllusVal final
     ~IllusVal() = default;
 
     double run(Input const&);
+    double run(yare_input const&);
+    double resume(Input const&, projection_checkpoint const&);
+
+    void set_checkpoint_interval(int);
+    std::vector<std::shared_ptr<projection_checkpoint const>> const& checkpoints() const;
+
+    void set_concurrent_bases(bool);
+    void set_secant_solves(bool);
 
     std::shared_ptr<Ledger const> ledger() const;
 
@@ -52,6 +63,10 @@ class IllusVal final
 
     std::string filename_;
     std::shared_ptr<Ledger const> ledger_;
+    int checkpoint_interval_ {0};
+    std::vector<std::shared_ptr<projection_checkpoint const>> checkpoints_;
+    bool concurrent_bases_ {false};
+    bool secant_solves_    {false};
 };
 
 #endif // ledgervalues_hpp
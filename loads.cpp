@@ -34,6 +34,58 @@
 #include "mc_enum_types_aux.hpp"        // mc_n_ enumerators
 #include "oecumenic_enumerations.hpp"
 #include "premium_tax.hpp"
+#include "weak_cache.hpp"
+#include "yare_input.hpp"
+
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace
+{
+/// Everything a production-branch Loads object depends upon.
+///
+/// Loads are calculated from database entries, which depend on the
+/// database axes; from premium-tax rates, which depend on the state
+/// of domicile (fixed for each product) and the premium-tax state
+/// (which may differ from the state of jurisdiction); and from a few
+/// input fields. All bases are calculated together, so the basis is
+/// not part of the key.
+
+using loads_key = std::tuple
+    <std::string            // ProductName
+    ,mcenum_gender          // Gender
+    ,mcenum_class           // UnderwritingClass
+    ,mcenum_smoking         // Smoking
+    ,int                    // IssueAge
+    ,mcenum_uw_basis        // GroupUnderwritingType
+    ,mcenum_state           // StateOfJurisdiction
+    ,mcenum_state           // PremiumTaxState
+    ,bool                   // AmortizePremiumLoad
+    ,std::vector<double>    // ExtraCompensationOnPremium
+    ,std::vector<double>    // ExtraCompensationOnAssets
+    ,std::vector<double>    // ExtraMonthlyCustodialFee
+    >;
+
+loads_key key_of(BasicValues const& V)
+{
+    yare_input const& z = V.yare_input_;
+    return loads_key
+        (z.ProductName
+        ,z.Gender
+        ,z.UnderwritingClass
+        ,z.Smoking
+        ,z.IssueAge
+        ,z.GroupUnderwritingType
+        ,z.StateOfJurisdiction
+        ,V.GetPremiumTaxState()
+        ,z.AmortizePremiumLoad
+        ,z.ExtraCompensationOnPremium
+        ,z.ExtraCompensationOnAssets
+        ,z.ExtraMonthlyCustodialFee
+        );
+}
+} // Unnamed namespace.
 
 /// Ctor for production branch.
 
@@ -66,6 +118,27 @@ Loads::Loads(BasicValues& V)
     Calculate(details);
 }
 
+/// Return an instance shared with any other live cell of the same key.
+///
+/// A census typically has many cells in a few states, which differ
+/// only in fields that don't affect loads. Each distinct combination
+/// is calculated once; cells that share it share one Loads object.
+///
+/// Only the load tables are shared. Each cell keeps its own class
+/// premium_tax object, which accumulates year-to-date premium for
+/// tiered rates and therefore cannot be shared.
+///
+/// See class weak_cache for the sharing policy.
+
+std::shared_ptr<Loads> Loads::shared_instance(BasicValues& V)
+{
+    static weak_cache<loads_key,Loads> cache;
+    return cache.retrieve_or_make
+        (key_of(V)
+        ,[&V] {return std::make_shared<Loads>(V);}
+        );
+}
+
 /// Reserve required space for vector data members.
 ///
 /// Zero-initializing everything is perhaps unnecessary, but the unit
@@ -26,6 +26,7 @@
 
 #include "mc_enum_type_enums.hpp"
 
+#include <memory>                       // shared_ptr
 #include <vector>
 
 class BasicValues;
@@ -43,6 +44,8 @@ class Loads
     Loads(BasicValues& values);
     Loads(product_database const&, bool NeedMidpointRates); // Antediluvian branch.
 
+    static std::shared_ptr<Loads> shared_instance(BasicValues&);
+
     // Accessors.
 
     // Typically, if a portion of the load is refundable on early
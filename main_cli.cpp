@@ -23,7 +23,10 @@
 
 #include "alert.hpp"
 #include "assert_lmi.hpp"
+#include "benchmark_suite.hpp"
 #include "calendar_date.hpp"
+#include "census_import.hpp"
+#include "configurable_settings.hpp"
 #include "contains.hpp"
 #include "dbdict.hpp"                   // print_databases()
 #include "getopt.hpp"
@@ -32,6 +35,7 @@
 #include "handle_exceptions.hpp"        // report_exception()
 #include "illustrator.hpp"
 #include "input.hpp"
+#include "istream_to_string.hpp"
 #include "ledger.hpp"
 #include "ledger_invariant.hpp"
 #include "ledger_variant.hpp"
@@ -42,14 +46,16 @@
 #include "mc_enum_types.hpp"
 #include "mc_enum_types_aux.hpp"        // allowed_strings_emission(), mc_emission_from_string()
 #include "mec_server.hpp"
-#include "miscellany.hpp"
-#include "path_utility.hpp"
+#include "miscellany.hpp"               // ios_out_trunc_binary(), rtrim()
+#include "multiple_cell_document.hpp"
+#include "path_utility.hpp"             // unique_filepath()
 #include "so_attributes.hpp"
 #include "timer.hpp"
 #include "value_cast.hpp"
 #include "verify_products.hpp"
 
 #include <boost/filesystem/convenience.hpp>
+#include <boost/filesystem/fstream.hpp>
 #include <boost/filesystem/path.hpp>
 
 #include <algorithm>                    // for_each()
@@ -58,12 +64,100 @@
 #include <functional>                   // bind()
 #include <ios>
 #include <iostream>
+#include <istream>
 #include <ostream>
 #include <sstream>
 #include <stdexcept>
+#include <streambuf>
 #include <string>
 #include <vector>
 
+/// Warn if an incremental re-run doesn't reproduce a full calculation.
+///
+/// Run 'original' with checkpoints, then run 'variation' with the same
+/// illustrator, which resumes from the latest checkpoint that the two
+/// inputs share; compare that to a full calculation of 'variation'.
+/// The illustrator's own verification is enabled too, so that it is
+/// exercised: it signals an error if the ledgers differ.
+
+void test_incremental_rerun(Input const& original, Input const& variation)
+{
+    illustrator full(mce_emit_nothing);
+    full("CLI_selftest", variation);
+    unsigned int const expected = full.principal_ledger()->CalculateCRC();
+
+    illustrator incremental(mce_emit_nothing);
+    incremental.set_checkpoint_interval(5);
+    incremental.set_verify_incremental_reruns(true);
+    incremental("CLI_selftest", original);
+    incremental("CLI_selftest", variation);
+    unsigned int const observed = incremental.principal_ledger()->CalculateCRC();
+
+    if(expected != observed)
+        {
+        warning()
+            << "Incremental re-run CRC should be "
+            << expected
+            << ", but is "
+            << observed
+            << " ."
+            << LMI_FLUSH
+            ;
+        }
+}
+
+/// Warn if running bases concurrently changes an illustration.
+
+void test_concurrent_bases(Input const& input)
+{
+    illustrator sequential(mce_emit_nothing);
+    sequential("CLI_selftest", input);
+    unsigned int const expected = sequential.principal_ledger()->CalculateCRC();
+
+    illustrator concurrent(mce_emit_nothing);
+    concurrent.set_concurrent_bases(true);
+    concurrent("CLI_selftest", input);
+    unsigned int const observed = concurrent.principal_ledger()->CalculateCRC();
+
+    if(expected != observed)
+        {
+        warning()
+            << "Concurrent-bases CRC should be "
+            << expected
+            << ", but is "
+            << observed
+            << " ."
+            << LMI_FLUSH
+            ;
+        }
+}
+
+/// Warn if solving by secants changes an illustration.
+
+void test_secant_solves(Input const& input)
+{
+    illustrator bisection(mce_emit_nothing);
+    bisection("CLI_selftest", input);
+    unsigned int const expected = bisection.principal_ledger()->CalculateCRC();
+
+    illustrator secant(mce_emit_nothing);
+    secant.set_secant_solves(true);
+    secant("CLI_selftest", input);
+    unsigned int const observed = secant.principal_ledger()->CalculateCRC();
+
+    if(expected != observed)
+        {
+        warning()
+            << "Secant-solve CRC should be "
+            << expected
+            << ", but is "
+            << observed
+            << " ."
+            << LMI_FLUSH
+            ;
+        }
+}
+
 /// Spot check and time some insurance calculations.
 ///
 /// The antediluvian fork's calculated results don't match the
@@ -140,6 +234,23 @@ void self_test()
             ;
         }
 
+    test_incremental_rerun(naic_no_solve     , naic_no_solve     );
+    test_incremental_rerun(naic_solve_specamt, naic_solve_specamt);
+
+    // Later bases read values, such as specified amount, that the
+    // current basis writes for future years, so they must reflect a
+    // changed withdrawal even if the checkpoint precedes it.
+    Input naic_withdrawal {naic_no_solve};
+    naic_withdrawal["Withdrawal"] = "0 12; 25000 20; 0";
+    naic_withdrawal.RealizeAllSequenceInput();
+    test_incremental_rerun(naic_no_solve, naic_withdrawal);
+
+    test_concurrent_bases(naic_no_solve     );
+    test_concurrent_bases(naic_solve_specamt);
+
+    test_secant_solves(naic_solve_specamt);
+    test_secant_solves(naic_solve_ee_prem);
+
     Input finra_no_solve      {naic_no_solve};
     Input finra_solve_specamt {naic_solve_specamt};
     Input finra_solve_ee_prem {naic_solve_ee_prem};
@@ -211,6 +322,293 @@ void product_test()
         }
 }
 
+namespace
+{
+/// Add comma-separated '--emit' suboptions to an emission.
+///
+/// Unrecognized suboptions are reported on stderr and ignored.
+
+mcenum_emission add_emission_suboptions
+    (mcenum_emission    emission
+    ,std::string const& suboptions
+    ,char const*        program_name
+    )
+{
+    std::istringstream iss(suboptions);
+    for(;EOF != iss.peek();)
+        {
+        std::string token;
+        std::getline(iss, token, ',');
+        if(!token.empty())
+            {
+            try
+                {
+                emission = mcenum_emission
+                    ( emission
+                    | mc_emission_from_string(token)
+                    );
+                }
+            catch(std::runtime_error const&)
+                {
+                std::cerr
+                    << program_name
+                    << ": unrecognized '--emit' suboption "
+                    << "'" << token << "'"
+                    << std::endl
+                    ;
+                }
+            }
+        }
+    return emission;
+}
+
+/// Run one input file of any type that '--file' accepts.
+///
+/// Illustrations are run by the given illustrator, so that its
+/// options and checkpoints carry over from one file to the next.
+
+void run_file
+    (fs::path const& file_path
+    ,mcenum_emission emission
+    ,illustrator&    illus
+    )
+{
+    std::string const e = fs::extension(file_path);
+    if(".cns" == e || ".ill" == e || ".ini" == e || ".inix" == e)
+        {
+        illus.set_emission(emission);
+        illus(file_path);
+        }
+    else if(".mec" == e)
+        {
+        mec_server z(emission);
+        z(file_path);
+        }
+    else if(".gpt" == e)
+        {
+        gpt_server z(emission);
+        z(file_path);
+        }
+    else
+        {
+        alarum()
+            << "'"
+            << file_path.string()
+            << "': unrecognized file extension."
+            << LMI_FLUSH
+            ;
+        }
+}
+
+/// Run all '.mec' and '.gpt' files listed in a manifest file.
+///
+/// The manifest lists one path per line; blank lines are ignored.
+/// Relative paths are taken as relative to the working directory, as
+/// for '--file'. Each type of file is run as one batch, on as many
+/// threads as the hardware supports, sharing all cached product data,
+/// and its results are written to a single spreadsheet named for the
+/// manifest: see run_server_batch().
+
+void run_manifest(fs::path const& manifest_path, mcenum_emission emission)
+{
+    fs::ifstream ifs(manifest_path);
+    if(!ifs)
+        {
+        alarum()
+            << "Unable to read manifest '"
+            << manifest_path.string()
+            << "'."
+            << LMI_FLUSH
+            ;
+        }
+
+    std::vector<fs::path> mec_paths;
+    std::vector<fs::path> gpt_paths;
+    std::string line;
+    while(std::getline(ifs, line))
+        {
+        rtrim(line, "\r");
+        if(line.empty())
+            {
+            continue;
+            }
+        std::string const e = fs::extension(line);
+        if(".mec" == e)
+            {
+            mec_paths.push_back(line);
+            }
+        else if(".gpt" == e)
+            {
+            gpt_paths.push_back(line);
+            }
+        else
+            {
+            warning()
+                << "'"
+                << line
+                << "': unrecognized file extension in manifest."
+                << LMI_FLUSH
+                ;
+            }
+        }
+
+    std::string const extension
+        (configurable_settings::instance().spreadsheet_file_extension()
+        );
+    if(!mec_paths.empty())
+        {
+        fs::path const p = unique_filepath(manifest_path, ".mec" + extension);
+        fs::ofstream ofs(p, ios_out_trunc_binary());
+        mec_server(emission).batch(mec_paths, ofs);
+        }
+    if(!gpt_paths.empty())
+        {
+        fs::path const p = unique_filepath(manifest_path, ".gpt" + extension);
+        fs::ofstream ofs(p, ios_out_trunc_binary());
+        gpt_server(emission).batch(gpt_paths, ofs);
+        }
+}
+
+/// Convert a tab-delimited census to a '.cns' file of the same name.
+///
+/// The census is parsed as if it had been pasted into a new census
+/// in the GUI, but its cells are reconciled concurrently.
+
+void import_census(fs::path const& tsv_path)
+{
+    fs::ifstream ifs(tsv_path);
+    if(!ifs)
+        {
+        alarum()
+            << "Unable to read census '"
+            << tsv_path.string()
+            << "'."
+            << LMI_FLUSH
+            ;
+        }
+    std::string census_data;
+    istream_to_string(ifs, census_data);
+
+    Input archetype;
+    std::vector<Input> const cells = cells_from_tab_delimited
+        (census_data
+        ,archetype
+        ,true
+        );
+    if(cells.empty())
+        {
+        return;
+        }
+
+    fs::path const cns_path = fs::change_extension(tsv_path, ".cns");
+    fs::ofstream ofs(cns_path, ios_out_trunc_binary());
+    multiple_cell_document(archetype, cells).write(ofs);
+}
+
+/// Divert std::cout to std::cerr for the lifetime of an instance.
+
+class stdout_diversion final
+{
+  public:
+    stdout_diversion()
+        :original_ {std::cout.rdbuf(std::cerr.rdbuf())}
+        {}
+    ~stdout_diversion() {std::cout.rdbuf(original_);}
+
+  private:
+    stdout_diversion(stdout_diversion const&) = delete;
+    stdout_diversion& operator=(stdout_diversion const&) = delete;
+
+    std::streambuf* original_;
+};
+
+/// Resident mode: run input files named on 'is', one per line.
+///
+/// Starting lmi_cli costs far more than running a single cell once
+/// product files, rate tables, and other cached data have been read.
+/// A client that needs many illustrations can therefore start one
+/// process and feed it requests through a pipe, or through a socket
+/// connected to stdin by a tool such as socat. Everything that
+/// file_cache retains stays warm from one request to the next, but
+/// mortality and load data held in weak caches are shared only while
+/// some calculation is using them, so each request reloads them.
+/// Illustrations are run by one illustrator, configured as the
+/// command line directs, for the whole session: a what-if variation
+/// can thus resume from checkpoints taken by an earlier request, as
+/// '--checkpoints' intends.
+///
+/// Each request is a line containing the path of an input file,
+/// optionally followed by a tab and '--emit' suboptions that replace
+/// the command line's for that request only. Blank lines are ignored,
+/// and "quit" or end of file ends the session. Before reading the
+/// first request, "ready" is written to 'os'. After each request, a
+/// line is written containing "done" or "failed", a tab, the path,
+/// a tab, and the elapsed time. Outputs are written to the requested
+/// emission targets as for '--file', except that anything that would
+/// be written to std::cout--warnings, timings, progress, and the
+/// output of '--emit=emit_text_stream'--is diverted to std::cerr for
+/// the whole session, so that 'os' carries nothing but those protocol
+/// lines even when it is std::cout. Diagnostics are shown as usual; a
+/// failed request doesn't end the session.
+
+void serve
+    (illustrator&    z
+    ,mcenum_emission emission
+    ,std::istream&   is
+    ,std::ostream&   os
+    ,char const*     program_name
+    )
+{
+    std::ostream protocol(os.rdbuf());
+    stdout_diversion const diversion;
+
+    protocol << "ready" << std::endl;
+    std::string line;
+    while(std::getline(is, line))
+        {
+        rtrim(line, "\r");
+        if(line.empty())
+            {
+            continue;
+            }
+        if("quit" == line)
+            {
+            break;
+            }
+
+        std::string::size_type const tab = line.find('\t');
+        std::string const file_path = line.substr(0, tab);
+        mcenum_emission const e =
+            (std::string::npos == tab)
+            ? emission
+            : add_emission_suboptions
+                (mce_emit_nothing
+                ,line.substr(1 + tab)
+                ,program_name
+                )
+            ;
+
+        Timer timer;
+        bool okay = false;
+        try
+            {
+            run_file(file_path, e, z);
+            okay = true;
+            }
+        catch(...)
+            {
+            report_exception();
+            }
+        protocol
+            << (okay ? "done" : "failed")
+            << '\t' << file_path
+            << '\t' << timer.stop().elapsed_msec_str()
+            << std::endl
+            ;
+        }
+}
+} // Unnamed namespace.
+
 void process_command_line(int argc, char* argv[])
 {
     // TRICKY !! Some long options are aliased to unlikely octal values.
@@ -221,27 +619,46 @@ void process_command_line(int argc, char* argv[])
         {"mellon"       ,NO_ARG   ,nullptr ,002 ,nullptr ,"pedo mellon a minno"},
         {"mello"        ,NO_ARG   ,nullptr ,077 ,nullptr ,"fraud"},
         {"prospicience" ,REQD_ARG ,nullptr ,003 ,nullptr ,"validation date"},
+        {"checkpoints"  ,REQD_ARG ,nullptr ,004 ,nullptr ,"checkpoint interval for what-if reruns"},
+        {"verify_reruns",NO_ARG   ,nullptr ,005 ,nullptr ,"check what-if reruns against full runs"},
+        {"concurrent"   ,NO_ARG   ,nullptr ,006 ,nullptr ,"run each cell's bases concurrently"},
+        {"secant_solves",NO_ARG   ,nullptr ,007 ,nullptr ,"solve nearly linear solves by secants"},
         {"accept"       ,NO_ARG   ,nullptr ,'a' ,nullptr ,"accept license (-l to display)"},
+        {"baseline"     ,REQD_ARG ,nullptr ,'c' ,nullptr ,"compare benchmark results to file"},
+        {"benchmark"    ,REQD_ARG ,nullptr ,'b' ,nullptr ,"time operations; write results to file"},
         {"data_path"    ,REQD_ARG ,nullptr ,'d' ,nullptr ,"path to data files"},
         {"emit"         ,REQD_ARG ,nullptr ,'e' ,nullptr ,"choose what output to emit"},
         {"file"         ,REQD_ARG ,nullptr ,'f' ,nullptr ,"input file to run"},
         {"help"         ,NO_ARG   ,nullptr ,'h' ,nullptr ,"display this help and exit"},
+        {"import_census",REQD_ARG ,nullptr ,'i' ,nullptr ,"convert tab-delimited census to .cns"},
         {"license"      ,NO_ARG   ,nullptr ,'l' ,nullptr ,"display license and exit"},
+        {"manifest"     ,REQD_ARG ,nullptr ,'m' ,nullptr ,"run .mec or .gpt files listed in file"},
         {"product_test" ,NO_ARG   ,nullptr ,'o' ,nullptr ,"validate products and exit"},
         {"print_db"     ,NO_ARG   ,nullptr ,'p' ,nullptr ,"print products and exit"},
         {"selftest"     ,NO_ARG   ,nullptr ,'s' ,nullptr ,"perform self test and exit"},
         {"test_db"      ,NO_ARG   ,nullptr ,'t' ,nullptr ,"test products and exit"},
         {"pyx"          ,REQD_ARG ,nullptr ,'x' ,nullptr ,"for docimasy"},
+        {"serve"        ,NO_ARG   ,nullptr ,'r' ,nullptr ,"run files named on stdin"},
         {nullptr        ,NO_ARG   ,nullptr ,000 ,nullptr ,""}
       };
 
     bool license_accepted    = false;
+    bool resident            = false;
+    int  checkpoint_interval = 0;
+    bool verify_reruns       = false;
+    bool concurrent_bases    = false;
+    bool secant_solves       = false;
 
     mcenum_emission emission(mce_emit_nothing);
 
+    std::string benchmark_name;
+    std::string baseline_name;
+
     std::vector<std::string> illustrator_names;
     std::vector<std::string> mec_server_names;
     std::vector<std::string> gpt_server_names;
+    std::vector<std::string> manifest_names;
+    std::vector<std::string> census_import_names;
 
     int digit_optind = 0;
     int this_option_optind = 1;
@@ -306,6 +723,44 @@ void process_command_line(int argc, char* argv[])
                 }
                 break;
 
+            case 004:
+                {
+                std::istringstream iss(getopt_long.optarg);
+                int years;
+                iss >> years;
+                if(!iss || !iss.eof())
+                    {
+                    warning() << "Invalid checkpoints option value '"
+                              << getopt_long.optarg
+                              << "' (must be a number of years)."
+                              << std::flush
+                              ;
+                    }
+                else
+                    {
+                    checkpoint_interval = years;
+                    }
+                }
+                break;
+
+            case 005:
+                {
+                verify_reruns = true;
+                }
+                break;
+
+            case 006:
+                {
+                concurrent_bases = true;
+                }
+                break;
+
+            case 007:
+                {
+                secant_solves = true;
+                }
+                break;
+
             case '0':
             case '1':
             case '2':
@@ -332,6 +787,20 @@ void process_command_line(int argc, char* argv[])
                 }
                 break;
 
+            case 'b':
+                {
+                LMI_ASSERT(nullptr != getopt_long.optarg);
+                benchmark_name = getopt_long.optarg;
+                }
+                break;
+
+            case 'c':
+                {
+                LMI_ASSERT(nullptr != getopt_long.optarg);
+                baseline_name = getopt_long.optarg;
+                }
+                break;
+
             case 'd':
                 {
                 global_settings::instance().set_data_directory
@@ -343,32 +812,11 @@ void process_command_line(int argc, char* argv[])
             case 'e':
                 {
                 LMI_ASSERT(nullptr != getopt_long.optarg);
-                std::string const s(getopt_long.optarg);
-                std::istringstream iss(s);
-                for(;EOF != iss.peek();)
-                    {
-                    std::string token;
-                    std::getline(iss, token, ',');
-                    if(!token.empty())
-                        {
-                        try
-                            {
-                            emission = mcenum_emission
-                                ( emission
-                                | mc_emission_from_string(token)
-                                );
-                            }
-                        catch(std::runtime_error const&)
-                            {
-                            std::cerr
-                                << argv[0]
-                                << ": unrecognized '--emit' suboption "
-                                << "'" << token << "'"
-                                << std::endl
-                                ;
-                            }
-                        }
-                    }
+                emission = add_emission_suboptions
+                    (emission
+                    ,getopt_long.optarg
+                    ,argv[0]
+                    );
                 }
                 break;
 
@@ -413,6 +861,13 @@ void process_command_line(int argc, char* argv[])
                 }
                 break;
 
+            case 'i':
+                {
+                LMI_ASSERT(nullptr != getopt_long.optarg);
+                census_import_names.push_back(getopt_long.optarg);
+                }
+                break;
+
             case 'l':
                 {
                 std::cerr << license_as_text() << "\n\n";
@@ -420,6 +875,13 @@ void process_command_line(int argc, char* argv[])
                 }
                 break;
 
+            case 'm':
+                {
+                LMI_ASSERT(nullptr != getopt_long.optarg);
+                manifest_names.push_back(getopt_long.optarg);
+                }
+                break;
+
             case 'o':
                 {
                 product_test();
@@ -434,6 +896,12 @@ void process_command_line(int argc, char* argv[])
                 }
                 break;
 
+            case 'r':
+                {
+                resident = true;
+                }
+                break;
+
             case 's':
                 {
                 self_test();
@@ -485,10 +953,16 @@ void process_command_line(int argc, char* argv[])
         std::cerr << license_notices_as_text() << "\n\n";
         }
 
+    illustrator z(emission);
+    z.set_concurrent_census_input(true);
+    z.set_checkpoint_interval(checkpoint_interval);
+    z.set_verify_incremental_reruns(verify_reruns);
+    z.set_concurrent_bases(concurrent_bases);
+    z.set_secant_solves(secant_solves);
     std::for_each
         (illustrator_names.begin()
         ,illustrator_names.end()
-        ,illustrator(emission)
+        ,z
         );
 
     std::for_each
@@ -502,6 +976,30 @@ void process_command_line(int argc, char* argv[])
         ,gpt_server_names.end()
         ,gpt_server(emission)
         );
+
+    for(auto const& i : manifest_names)
+        {
+        run_manifest(i, emission);
+        }
+
+    for(auto const& i : census_import_names)
+        {
+        import_census(i);
+        }
+
+    if(!benchmark_name.empty())
+        {
+        benchmark_suite(benchmark_name, baseline_name);
+        }
+    else if(!baseline_name.empty())
+        {
+        warning() << "Option '--baseline' requires '--benchmark'." << LMI_FLUSH;
+        }
+
+    if(resident)
+        {
+        serve(z, emission, std::cin, std::cout, argv[0]);
+        }
 }
 
 int try_main(int argc, char* argv[])
@@ -0,0 +1,196 @@
+// Read-only memory-mapped files.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#include "pchfile.hpp"
+
+#include "mapped_file.hpp"
+
+#include "alert.hpp"
+#include "bourn_cast.hpp"
+
+#include <string>
+
+#if defined LMI_POSIX
+#   include <fcntl.h>                   // open(), O_RDONLY
+#   include <sys/mman.h>                // mmap(), munmap()
+#   include <sys/stat.h>                // fstat()
+#   include <unistd.h>                  // close()
+#elif defined LMI_MSW
+#   include <windows.h>
+#else // Unknown platform.
+#   error Unknown platform. Consider contributing support.
+#endif // Unknown platform.
+
+mapped_file::mapped_file(fs::path const& path)
+{
+    std::string const name = path.string();
+
+#if defined LMI_POSIX
+    int const fd = ::open(name.c_str(), O_RDONLY);
+    if(-1 == fd)
+        {
+        alarum() << "Unable to open '" << path << "'." << LMI_FLUSH;
+        }
+
+    struct stat st;
+    if(-1 == ::fstat(fd, &st))
+        {
+        ::close(fd);
+        alarum() << "Unable to determine size of '" << path << "'." << LMI_FLUSH;
+        }
+    size_ = bourn_cast<std::size_t>(st.st_size);
+
+    if(0 != size_)
+        {
+        void* const p = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if(MAP_FAILED == p)
+            {
+            ::close(fd);
+            alarum() << "Unable to map '" << path << "'." << LMI_FLUSH;
+            }
+        data_ = static_cast<char const*>(p);
+        }
+
+    // The mapping remains valid after the descriptor is closed.
+    ::close(fd);
+#elif defined LMI_MSW
+    HANDLE const file = ::CreateFileA
+        (name.c_str()
+        ,GENERIC_READ
+        ,FILE_SHARE_READ
+        ,nullptr
+        ,OPEN_EXISTING
+        ,FILE_ATTRIBUTE_NORMAL
+        ,nullptr
+        );
+    if(INVALID_HANDLE_VALUE == file)
+        {
+        alarum() << "Unable to open '" << path << "'." << LMI_FLUSH;
+        }
+
+    LARGE_INTEGER file_size;
+    if(!::GetFileSizeEx(file, &file_size))
+        {
+        ::CloseHandle(file);
+        alarum() << "Unable to determine size of '" << path << "'." << LMI_FLUSH;
+        }
+    size_ = bourn_cast<std::size_t>(file_size.QuadPart);
+
+    if(0 != size_)
+        {
+        HANDLE const mapping = ::CreateFileMappingA
+            (file
+            ,nullptr
+            ,PAGE_READONLY
+            ,0
+            ,0
+            ,nullptr
+            );
+        void* const p =
+            mapping
+            ? ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0)
+            : nullptr
+            ;
+        if(mapping)
+            {
+            // The view remains valid after the mapping is closed.
+            ::CloseHandle(mapping);
+            }
+        if(!p)
+            {
+            ::CloseHandle(file);
+            alarum() << "Unable to map '" << path << "'." << LMI_FLUSH;
+            }
+        data_ = static_cast<char const*>(p);
+        }
+
+    ::CloseHandle(file);
+#endif // defined LMI_MSW
+}
+
+mapped_file::~mapped_file()
+{
+    if(!data_)
+        {
+        return;
+        }
+
+#if defined LMI_POSIX
+    ::munmap(const_cast<char*>(data_), size_);
+#elif defined LMI_MSW
+    ::UnmapViewOfFile(data_);
+#endif // defined LMI_MSW
+}
+
+memory_streambuf::memory_streambuf(char const* data, std::size_t size)
+{
+    // The get area is never written through, so casting away
+    // constness is harmless.
+    char* const p = const_cast<char*>(data);
+    setg(p, p, p + size);
+}
+
+std::streambuf::pos_type memory_streambuf::seekoff
+    (off_type                off
+    ,std::ios_base::seekdir  dir
+    ,std::ios_base::openmode which
+    )
+{
+    pos_type const failure {off_type(-1)};
+    if(!(which & std::ios_base::in))
+        {
+        return failure;
+        }
+
+    off_type origin = 0;
+    switch(dir)
+        {
+        case std::ios_base::beg: origin = 0;                 break;
+        case std::ios_base::cur: origin = gptr()  - eback(); break;
+        case std::ios_base::end: origin = egptr() - eback(); break;
+        default: return failure;
+        }
+
+    off_type const z = origin + off;
+    if(z < 0 || egptr() - eback() < z)
+        {
+        return failure;
+        }
+
+    setg(eback(), eback() + z, egptr());
+    return pos_type(z);
+}
+
+std::streambuf::pos_type memory_streambuf::seekpos
+    (pos_type                pos
+    ,std::ios_base::openmode which
+    )
+{
+    return seekoff(off_type(pos), std::ios_base::beg, which);
+}
+
+mapped_file_istream::mapped_file_istream(fs::path const& path)
+    :std::istream {nullptr}
+    ,file_        {path}
+    ,buf_         {file_.data(), file_.size()}
+{
+    rdbuf(&buf_);
+}
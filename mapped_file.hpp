@@ -0,0 +1,103 @@
+// Read-only memory-mapped files.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#ifndef mapped_file_hpp
+#define mapped_file_hpp
+
+#include "config.hpp"
+
+#include "so_attributes.hpp"
+
+#include <boost/filesystem/path.hpp>
+
+#include <cstddef>                      // size_t
+#include <ios>
+#include <istream>
+#include <streambuf>
+
+/// Entire contents of a file, mapped read-only into memory.
+///
+/// Pages are read from disk only when first touched, so mapping even
+/// a very large file costs little until its contents are accessed.
+/// The file must not be modified while it is mapped.
+///
+/// An empty file is mapped as a null pointer with zero size, because
+/// the operating system won't map zero bytes.
+
+class LMI_SO mapped_file final
+{
+  public:
+    explicit mapped_file(fs::path const&);
+    ~mapped_file();
+
+    char const* data() const {return data_;}
+    std::size_t size() const {return size_;}
+
+  private:
+    mapped_file(mapped_file const&) = delete;
+    mapped_file& operator=(mapped_file const&) = delete;
+
+    char const* data_ {nullptr};
+    std::size_t size_ {0};
+};
+
+/// Input stream buffer reading a fixed range of memory in place.
+///
+/// Unlike std::stringbuf, it neither copies nor owns the memory.
+
+class LMI_SO memory_streambuf final
+    :public std::streambuf
+{
+  public:
+    memory_streambuf(char const* data, std::size_t size);
+
+  protected:
+    pos_type seekoff(off_type, std::ios_base::seekdir, std::ios_base::openmode) override;
+    pos_type seekpos(pos_type, std::ios_base::openmode) override;
+
+  private:
+    memory_streambuf(memory_streambuf const&) = delete;
+    memory_streambuf& operator=(memory_streambuf const&) = delete;
+};
+
+/// Input stream reading a mapped file in place.
+///
+/// Code written for std::istream can thus read a file without making
+/// a system call for each read, or copying the file into memory.
+
+class LMI_SO mapped_file_istream final
+    :public std::istream
+{
+  public:
+    explicit mapped_file_istream(fs::path const&);
+    ~mapped_file_istream() override = default;
+
+    std::size_t size() const {return file_.size();}
+
+  private:
+    mapped_file_istream(mapped_file_istream const&) = delete;
+    mapped_file_istream& operator=(mapped_file_istream const&) = delete;
+
+    mapped_file      file_;
+    memory_streambuf buf_;
+};
+
+#endif // mapped_file_hpp
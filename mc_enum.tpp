@@ -60,15 +60,18 @@ mc_enum<T>::mc_enum(std::string const& s)
 template<typename T>
 mc_enum<T>& mc_enum<T>::operator=(T t)
 {
-    value_ = t;
+    if(t != value_)
+        {
+        value_ = t;
+        note_change();
+        }
     return *this;
 }
 
 template<typename T>
 mc_enum<T>& mc_enum<T>::operator=(std::string const& s)
 {
-    value_ = e()[ordinal(s)];
-    return *this;
+    return operator=(e()[ordinal(s)]);
 }
 
 template<typename T>
@@ -148,7 +151,7 @@ void mc_enum<T>::enforce_proscription()
     int z = first_allowed_ordinal();
     if(z < cardinality())
         {
-        value_ = e()[z];
+        operator=(e()[z]);
         }
 }
 
@@ -253,7 +256,7 @@ std::istream& mc_enum<T>::read(std::istream& is)
         ordinal(s); // Throws.
         throw "Unreachable.";
         }
-    value_ = e()[v];
+    operator=(e()[v]);
 
     return is;
 }
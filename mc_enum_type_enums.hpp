@@ -53,6 +53,7 @@ enum mcenum_emission
     ,mce_emit_custom_0       = 1024
     ,mce_emit_custom_1       = 2048
     ,mce_emit_group_quote    = 4096
+    ,mce_emit_columnar       = 8192
     };
 
 /// Rounding styles.
@@ -46,6 +46,7 @@
 #include "premium_tax.hpp"
 #include "product_data.hpp"
 #include "round_to.hpp"
+#include "server_batch.hpp"
 #include "ssize_lmi.hpp"
 #include "stratified_algorithms.hpp"    // TieredGrossToNet()
 #include "stratified_charges.hpp"
@@ -55,9 +56,10 @@
 #include <boost/filesystem/convenience.hpp> // extension(), change_extension()
 #include <boost/filesystem/fstream.hpp>
 
-#include <algorithm>                    // min()
+#include <algorithm>                    // max(), min()
 #include <iostream>
 #include <string>
+#include <thread>                       // hardware_concurrency()
 #include <vector>
 
 namespace
@@ -65,6 +67,7 @@ namespace
 mec_state test_one_days_7702A_transactions
     (fs::path  const& file_path
     ,mec_input const& input
+    ,bool             write_spreadsheet
     )
 {
     bool                        Use7702ATables               = exact_cast<mce_yes_or_no           >(input["Use7702ATables"              ])->value();
@@ -416,6 +419,12 @@ mec_state test_one_days_7702A_transactions
             );
         }
 
+    // Batches would write far too many of these temporary files.
+    if(!write_spreadsheet)
+        {
+        return z.state();
+        }
+
     std::vector<double> ratio_Ax (input.years_to_maturity());
     ratio_Ax  += tabular_Ax  / analytic_Ax ;
     std::vector<double> ratio_7Px(input.years_to_maturity());
@@ -514,10 +523,30 @@ bool mec_server::operator()(fs::path const& file_path)
         }
 }
 
+/// Run many files concurrently, writing their final states to one table.
+///
+/// See run_server_batch(). The temporary per-contract spreadsheets
+/// that operator() writes are suppressed.
+
+void mec_server::batch
+    (std::vector<fs::path> const& file_paths
+    ,std::ostream&                os
+    )
+{
+    mec_server prototype(*this);
+    prototype.in_batch_ = true;
+    run_server_batch
+        (prototype
+        ,file_paths
+        ,os
+        ,std::max(1, static_cast<int>(std::thread::hardware_concurrency()))
+        );
+}
+
 bool mec_server::operator()(fs::path const& file_path, mec_input const& z)
 {
     Timer timer;
-    state_ = test_one_days_7702A_transactions(file_path, z);
+    state_ = test_one_days_7702A_transactions(file_path, z, !in_batch_);
     seconds_for_calculations_ = timer.stop().elapsed_seconds();
     timer.restart();
     if(mce_emit_test_data & emission_)
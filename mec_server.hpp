@@ -30,6 +30,9 @@
 
 #include <boost/filesystem/path.hpp>
 
+#include <iosfwd>
+#include <vector>
+
 class mec_input;
 
 /// MEC-testing server.
@@ -53,6 +56,8 @@ class LMI_SO mec_server final
     bool operator()(fs::path const&);
     bool operator()(fs::path const&, mec_input const&);
 
+    void batch(std::vector<fs::path> const&, std::ostream&);
+
     void conditionally_show_timings_on_stdout() const;
 
     mec_state state() const;
@@ -67,6 +72,7 @@ class LMI_SO mec_server final
     double seconds_for_input_        {0.0};
     double seconds_for_calculations_ {0.0};
     double seconds_for_output_       {0.0};
+    bool in_batch_                   {false};
 };
 
 #endif // mec_server_hpp
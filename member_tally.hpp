@@ -0,0 +1,153 @@
+// Tally of distinct member values across objects.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+
+#ifndef member_tally_hpp
+#define member_tally_hpp
+
+#include "config.hpp"
+
+#include "any_member.hpp"
+#include "assert_lmi.hpp"
+#include "ssize_lmi.hpp"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/// Tally of distinct member values across a collection of objects.
+///
+/// Motivation: A census view displays only those columns (members of
+/// class Input) whose values are not identical for every cell. Finding
+/// them by comparing every cell to the case defaults costs O(columns *
+/// cells) whenever anything changes. Instead, the number of objects
+/// having each distinct value of each member is adjusted as objects
+/// are added, removed, or changed, so that ascertaining whether any
+/// object differs from a given value costs O(1) per member.
+///
+/// Members are identified by their indices in member_names(). Values
+/// are compared as strings, as returned by any_member::str().
+///
+/// A tally may be invalidated when its objects change wholesale, so
+/// that it needn't be kept current; then add() and remove() do nothing
+/// until it is rebuilt.
+
+template<typename ClassType>
+class member_tally final
+{
+  public:
+    /// Remove an object from the tally while it is being changed, and
+    /// add it back afterward--even if an exception is thrown.
+
+    class change final
+    {
+      public:
+        change(member_tally& tally, MemberSymbolTable<ClassType> const& object)
+            :tally_  {tally}
+            ,object_ {object}
+            {
+            tally_.remove(object_);
+            }
+
+        ~change() {tally_.add(object_);}
+
+      private:
+        change(change const&) = delete;
+        change& operator=(change const&) = delete;
+
+        member_tally&                       tally_;
+        MemberSymbolTable<ClassType> const& object_;
+    };
+
+    member_tally() = default;
+
+    template<typename Iterator>
+    void rebuild(Iterator first, Iterator last)
+        {
+        counts_.clear();
+        valid_ = true;
+        for(; first != last; ++first)
+            {
+            add(*first);
+            }
+        }
+
+    void invalidate() {valid_ = false;}
+    bool is_valid() const {return valid_;}
+
+    void add(MemberSymbolTable<ClassType> const& z)
+        {
+        if(!valid_)
+            {
+            return;
+            }
+        std::vector<std::string> const& names = z.member_names();
+        counts_.resize(names.size());
+        for(int j = 0; j < lmi::ssize(names); ++j)
+            {
+            ++counts_[j][z[names[j]].str()];
+            }
+        }
+
+    /// Precondition: the object was added, and hasn't changed since.
+
+    void remove(MemberSymbolTable<ClassType> const& z)
+        {
+        if(!valid_)
+            {
+            return;
+            }
+        std::vector<std::string> const& names = z.member_names();
+        LMI_ASSERT(counts_.size() == names.size());
+        for(int j = 0; j < lmi::ssize(names); ++j)
+            {
+            auto& c = counts_[j];
+            auto const i = c.find(z[names[j]].str());
+            LMI_ASSERT(c.end() != i);
+            if(0 == --i->second)
+                {
+                c.erase(i);
+                }
+            }
+        }
+
+    /// Ascertain whether any object's member differs from 'value'.
+
+    bool varies_from(int column, std::string const& value) const
+        {
+        LMI_ASSERT(valid_);
+        if(counts_.empty())
+            {
+            return false;
+            }
+        auto const& c = counts_.at(column);
+        return 1 < c.size() || 1 == c.size() && value != c.begin()->first;
+        }
+
+  private:
+    member_tally(member_tally const&) = delete;
+    member_tally& operator=(member_tally const&) = delete;
+
+    std::vector<std::unordered_map<std::string,int>> counts_;
+    bool valid_ {false};
+};
+
+#endif // member_tally_hpp
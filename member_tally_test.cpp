@@ -0,0 +1,127 @@
+// Tally of distinct member values across objects--unit test.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+
+#include "pchfile.hpp"
+
+#include "member_tally.hpp"
+
+#include "test_tools.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+class T
+    :public MemberSymbolTable<T>
+{
+  public:
+    T(int i, std::string const& s)
+        :i0 {i}
+        ,s0 {s}
+        {
+        ascribe("i0", &T::i0);
+        ascribe("s0", &T::s0);
+        }
+
+    T(T const& z)
+        :MemberSymbolTable<T> {}
+        ,i0 {z.i0}
+        ,s0 {z.s0}
+        {
+        ascribe("i0", &T::i0);
+        ascribe("s0", &T::s0);
+        }
+
+    int         i0;
+    std::string s0;
+};
+
+void test_member_tally()
+{
+    // Members are ascribed in this order.
+    int const i0 = 0;
+    int const s0 = 1;
+
+    std::vector<T> v {T(1, "a"), T(1, "b")};
+    member_tally<T> tally;
+    BOOST_TEST(!tally.is_valid());
+    BOOST_TEST_THROW
+        (tally.varies_from(i0, "1")
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Assertion.*failed")
+        );
+
+    tally.rebuild(v.begin(), v.end());
+    BOOST_TEST( tally.is_valid());
+    BOOST_TEST(!tally.varies_from(i0, "1"));
+    BOOST_TEST( tally.varies_from(i0, "2"));
+    BOOST_TEST( tally.varies_from(s0, "a"));
+
+    // Removing and adding objects changes the tally.
+    tally.remove(v[1]);
+    BOOST_TEST(!tally.varies_from(s0, "a"));
+    tally.add(v[1]);
+    BOOST_TEST( tally.varies_from(s0, "a"));
+
+    // A change is tallied when it's complete.
+    {
+    member_tally<T>::change c(tally, v[1]);
+    v[1].s0 = "a";
+    }
+    BOOST_TEST(!tally.varies_from(s0, "a"));
+
+    // ...even if an exception is thrown.
+    try
+        {
+        member_tally<T>::change c(tally, v[0]);
+        v[0].i0 = 2;
+        throw std::runtime_error("");
+        }
+    catch(std::runtime_error const&) {}
+    BOOST_TEST( tally.varies_from(i0, "1"));
+    BOOST_TEST( tally.varies_from(i0, "2"));
+
+    // Removing an object that hasn't been added is an error.
+    T const t(3, "c");
+    BOOST_TEST_THROW
+        (tally.remove(t)
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Assertion.*failed")
+        );
+
+    // An invalid tally ignores changes until it's rebuilt.
+    tally.invalidate();
+    tally.add(t);
+    tally.rebuild(v.begin(), v.begin() + 1);
+    BOOST_TEST(!tally.varies_from(i0, "2"));
+    BOOST_TEST(!tally.varies_from(s0, "a"));
+
+    // An empty tally varies from nothing.
+    tally.rebuild(v.end(), v.end());
+    BOOST_TEST(!tally.varies_from(i0, "0"));
+}
+
+int test_main(int, char*[])
+{
+    test_member_tally();
+
+    return EXIT_SUCCESS;
+}
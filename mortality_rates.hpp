@@ -24,12 +24,16 @@
 
 #include "config.hpp"
 
+#include "actuarial_table.hpp"          // e_actuarial_table_method
 #include "mc_enum_type_enums.hpp"
 #include "round_to.hpp"
 
+#include <memory>                       // shared_ptr
+#include <tuple>
 #include <vector>
 
 class BasicValues;
+class calendar_date;
 
 /// Design notes--class MortalityRates
 ///
@@ -51,6 +55,9 @@ class BasicValues;
 /// When that's done, it may make sense to reduce initialization
 /// overhead by calculating each private member's value only when
 /// it's first needed.
+///
+/// Instances are immutable once constructed, so cells that would
+/// construct identical instances can share one: see shared_instance().
 
 class MortalityRates
 {
@@ -59,6 +66,8 @@ class MortalityRates
   public:
     MortalityRates(BasicValues const&);
 
+    static std::shared_ptr<MortalityRates> shared_instance(BasicValues const&);
+
     std::vector<double> const& MonthlyCoiRates(mcenum_gen_basis) const; // Antediluvian.
 
     std::vector<double> const& MonthlyCoiRatesBand0(mcenum_gen_basis) const;
@@ -86,6 +95,13 @@ class MortalityRates
 
     void Init(BasicValues const&); // Antediluvian.
 
+    static std::tuple<e_actuarial_table_method,int,int> inforce_reentry_key
+        (e_actuarial_table_method method
+        ,int                      inforce_year
+        ,calendar_date const&     effective_date
+        ,calendar_date const&     last_reentry_date
+        );
+
     void reserve_vectors();
     void fetch_parameters(BasicValues const&);
     void initialize();
@@ -24,6 +24,7 @@
 #include "mortality_rates.hpp"
 
 #include "assert_lmi.hpp"
+#include "calendar_date.hpp"
 #include "materially_equal.hpp"
 #include "math_functions.hpp"
 #include "ssize_lmi.hpp"
@@ -112,6 +113,7 @@ class mortality_rates_test
         test_guaranteed_rates( 1.1, 1.0, round_to<double>(0, r_not_at_all));
         test_guaranteed_rates( 1.0, 0.9, round_to<double>(0, r_not_at_all));
         test_guaranteed_rates(10.0, 0.9, round_to<double>(0, r_not_at_all));
+        test_inforce_reentry_key();
         }
 
   private:
@@ -122,6 +124,7 @@ class mortality_rates_test
         ,double           max
         ,round_to<double> rounder
         );
+    static void test_inforce_reentry_key();
 };
 
 /// Test a calculation that ought to be exact.
@@ -212,6 +215,37 @@ void mortality_rates_test::test_guaranteed_rates
         }
 }
 
+/// Test the inforce data that distinguish shared instances.
+///
+/// Absent reentry, inforce cells share an instance regardless of
+/// their inforce year and reentry date. Otherwise, they share one
+/// only if those data yield the same table lookup.
+
+void mortality_rates_test::test_inforce_reentry_key()
+{
+    auto const key = MortalityRates::inforce_reentry_key;
+
+    calendar_date const effective (2001, 1, 1);
+    calendar_date const reentry_4 (2005, 1, 1);
+    calendar_date const reentry_7a(2007, 9, 1);
+    calendar_date const reentry_7b(2008, 1, 1);
+
+    e_actuarial_table_method const never = e_reenter_never;
+    BOOST_TEST(key(never, 3, effective, reentry_4) == key(never, 9, effective, reentry_7a));
+    BOOST_TEST_EQUAL(0, std::get<1>(key(never, 3, effective, reentry_4)));
+    BOOST_TEST_EQUAL(0, std::get<2>(key(never, 3, effective, reentry_4)));
+
+    e_actuarial_table_method const reset = e_reenter_upon_rate_reset;
+    BOOST_TEST(key(reset, 3, effective, reentry_4 ) != key(reset, 9, effective, reentry_4 ));
+    BOOST_TEST(key(reset, 9, effective, reentry_4 ) != key(reset, 9, effective, reentry_7a));
+    BOOST_TEST(key(reset, 9, effective, reentry_7a) == key(reset, 9, effective, reentry_7b));
+    BOOST_TEST_EQUAL(4, std::get<2>(key(reset, 9, effective, reentry_4 )));
+    BOOST_TEST_EQUAL(7, std::get<2>(key(reset, 9, effective, reentry_7a)));
+
+    e_actuarial_table_method const inforce = e_reenter_at_inforce_duration;
+    BOOST_TEST(key(inforce, 9, effective, reentry_4) != key(reset, 9, effective, reentry_4));
+}
+
 int test_main(int, char*[])
 {
     mortality_rates_test::test();
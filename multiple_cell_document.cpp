@@ -70,6 +70,21 @@ multiple_cell_document::multiple_cell_document(std::string const& filename)
     parse(parser);
 }
 
+/// Construct from a case default and cells.
+///
+/// The case default serves as the sole class default, too.
+
+multiple_cell_document::multiple_cell_document
+    (Input              const& case_default
+    ,std::vector<Input> const& cells
+    )
+    :case_parms_  (1, case_default)
+    ,class_parms_ (1, case_default)
+    ,cell_parms_  (cells)
+{
+    assert_vector_sizes_are_sane();
+}
+
 /// Verify invariants.
 ///
 /// Throws if any asserted invariant does not hold.
@@ -85,6 +85,10 @@ class LMI_SO multiple_cell_document final
   public:
     multiple_cell_document();
     multiple_cell_document(std::string const& filename);
+    multiple_cell_document
+        (Input              const& case_default
+        ,std::vector<Input> const& cells
+        );
     ~multiple_cell_document() = default;
 
     std::vector<Input> const& case_parms() const;
@@ -26,6 +26,10 @@
 #include "alert.hpp"
 #include "any_entity.hpp"
 #include "assert_lmi.hpp"
+#include "datum_base.hpp"
+
+#include <cstdint>                      // uint64_t
+#include <utility>                      // pair
 
 namespace
 {
@@ -89,10 +93,53 @@ MvcModel::StateType MvcModel::State() const
     return DoState();
 }
 
+/// Reconcile the Model's state.
+///
+/// Only data changed during an iteration are examined. State() is
+/// called once, at the outset; thereafter, whenever a datum's
+/// revision shows that it has been assigned since the iteration began,
+/// its string representation is compared to the value recorded for
+/// it, and the record is updated. A datum may be assigned without
+/// changing its value (copy assignment is always counted as a change),
+/// so revisions alone don't settle whether it really changed.
+///
+/// AdaptExternalities() changes no datum of this class, so any datum
+/// that changes between the start of an iteration and the end of
+/// Harmonize() was changed improperly by Harmonize().
+
 void MvcModel::Reconcile()
 {
-    StateType new_values = State();
-    StateType old_values;
+    StateType values = State();
+
+    std::vector<std::pair<std::string const*,datum_base const*>> data;
+    data.reserve(Names().size());
+    for(auto const& i : Names())
+        {
+        data.emplace_back(&i, BaseDatumPointer(i));
+        }
+
+    // Update 'values' for all data changed since revision 'r', and
+    // return their prior and current values.
+    auto const changes = [&] (std::uint64_t r)
+        {
+        std::pair<StateType,StateType> z;
+        for(auto const& i : data)
+            {
+            if(r < i.second->revision())
+                {
+                std::string const& name = *i.first;
+                std::string const s = Entity(name).str();
+                std::string& v = values[name];
+                if(s != v)
+                    {
+                    z.first [name] = v;
+                    z.second[name] = s;
+                    v = s;
+                    }
+                }
+            }
+        return z;
+        };
 
     bool okay = false;
     int j = 0;
@@ -100,12 +147,21 @@ void MvcModel::Reconcile()
 
     for(; !okay && j < maximum_iterations; ++j)
         {
+        std::uint64_t const before_harmonize = datum_base::latest_revision();
         AdaptExternalities();
-        Harmonize();
+        DoHarmonize();
+        auto const harmonized = changes(before_harmonize);
+        ComplainAboutAnyDiscrepancies
+            (harmonized.first
+            ,harmonized.second
+            ,"Harmonize() improperly forces values to change:"
+            );
+        std::uint64_t const before_transmogrify = datum_base::latest_revision();
         Transmogrify();
-        old_values.swap(new_values);
-        new_values = State();
-        okay = new_values == old_values;
+        okay =
+                harmonized.first.empty()
+            && changes(before_transmogrify).first.empty()
+            ;
         }
 
     if(!okay)
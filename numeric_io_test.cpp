@@ -216,6 +216,19 @@ int test_main(int, char*[])
         BOOST_TEST(false);
         }
 
+    // std::from_chars() rejects these, but strtoX() has always
+    // accepted them, so they're still accepted.
+    BOOST_TEST_EQUAL(1.0, numeric_io_cast<double>(" 1"));
+    BOOST_TEST_EQUAL(1.0, numeric_io_cast<double>("+1"));
+    BOOST_TEST_EQUAL(8.0, numeric_io_cast<double>("0x1p3"));
+    BOOST_TEST_EQUAL(1  , numeric_io_cast<int>   ("+1"));
+    BOOST_TEST_EQUAL(1U , numeric_io_cast<unsigned int>(" 1"));
+
+    // No fractional digits are exact, so none is written; nor is a
+    // decimal point.
+    test_interconvertibility(1.0e15, "1000000000000000", __FILE__, __LINE__);
+    test_interconvertibility(-1.0e20, "-100000000000000000000", __FILE__, __LINE__);
+
     // Interpreted as decimal, not as octal.
     BOOST_TEST_EQUAL(77, numeric_io_cast<int>( "077"));
 
@@ -30,6 +30,7 @@
 #include "miscellany.hpp"               // rtrim()
 
 #include <algorithm>                    // max()
+#include <charconv>                     // from_chars(), to_chars()
 #include <cmath>                        // fabs(), log10()
 #include <cstdlib>                      // strto*()
 #include <cstring>                      // strcmp(), strlen()
@@ -122,24 +123,46 @@ inline std::string simplify_floating_point(std::string const& s)
 /// tedious approach avoids the slight overhead of calling the
 /// conversion function through a pointer and guarding against actual
 /// narrowing conversions.
+///
+/// Integral conversions are normally performed by from_chars() and
+/// to_chars(), which forward to their <charconv> namesakes. Unlike
+/// the C library functions, those don't consult the locale, and
+/// they're much faster. For strings that std::from_chars() rejects
+/// or doesn't consume entirely, strtoT() is used as a fallback, so
+/// that strings with leading whitespace or a '+' sign are treated
+/// exactly as before, and diagnostics are unchanged.
+///
+/// Floating-point conversions use strtoT() and std::snprintf() with
+/// fmt() and digits(), because libstdc++ provides floating-point
+/// <charconv> only as of gcc-11.
 
 template<typename T>
 struct numeric_conversion_traits
 {
+    static std::from_chars_result from_chars(char const*, char const*, T&);
+    static std::to_chars_result to_chars(char*, char*, T);
     static int digits(T);
     static char const* fmt();
     static std::string simplify(std::string const&);
     static T strtoT(char const*, char**);
 };
 
-/// Return C99 7.19.6.1/8 default precision for integral types.
-/// Calling std::snprintf() with a precision of zero and a value of
-/// zero would return no characters.
+/// Integers are written as if by std::snprintf() with the C99
+/// 7.19.6.1/8 default precision of one, i.e., with no leading zeros.
 
 struct Integral{};
 template<> struct numeric_conversion_traits<Integral>
 {
-    template<typename T> static int digits(T) {return 1;}
+    template<typename T>
+    static std::from_chars_result from_chars
+        (char const* first
+        ,char const* last
+        ,T&          t
+        )
+        {return std::from_chars(first, last, t);}
+    template<typename T>
+    static std::to_chars_result to_chars(char* first, char* last, T t)
+        {return std::to_chars(first, last, t);}
     static std::string simplify(std::string const& s) {return s;}
 };
 
@@ -147,13 +170,6 @@ template<> struct numeric_conversion_traits<char>
     :public numeric_conversion_traits<Integral>
 {
     typedef char T;
-    static char const* fmt()
-        {
-        return std::numeric_limits<T>::is_signed
-            ? "%.*i"
-            : "%.*u"
-            ;
-        }
     static T strtoT(char const* nptr, char** endptr)
         {
         return std::numeric_limits<T>::is_signed
@@ -169,7 +185,6 @@ template<> struct numeric_conversion_traits<signed char>
     :public numeric_conversion_traits<Integral>
 {
     typedef signed char T;
-    static char const* fmt() {return "%.*i";}
     static T strtoT(char const* nptr, char** endptr)
         {return bourn_cast<T>(std::strtol(nptr, endptr, 10));}
 };
@@ -180,7 +195,6 @@ template<> struct numeric_conversion_traits<unsigned char>
     :public numeric_conversion_traits<Integral>
 {
     typedef unsigned char T;
-    static char const* fmt() {return "%.*u";}
     static T strtoT(char const* nptr, char** endptr)
         {return bourn_cast<T>(std::strtoul(nptr, endptr, 10));}
 };
@@ -192,7 +206,6 @@ template<> struct numeric_conversion_traits<wchar_t>
     :public numeric_conversion_traits<Integral>
 {
     typedef wchar_t T;
-    static char const* fmt() {return "%.*lc";}
     static T strtoT(char const* nptr, char** endptr)
         {return bourn_cast<T>(std::strtol(nptr, endptr, 10));}
 };
@@ -202,7 +215,24 @@ template<> struct numeric_conversion_traits<bool>
     :public numeric_conversion_traits<Integral>
 {
     typedef bool T;
-    static char const* fmt() {return "%.*i";}
+    // <charconv> doesn't support bool, so convert through int.
+    static std::from_chars_result from_chars
+        (char const* first
+        ,char const* last
+        ,T&          t
+        )
+        {
+        int z {};
+        auto const r = std::from_chars(first, last, z);
+        if(std::errc() == r.ec && (0 == z || 1 == z))
+            {
+            t = static_cast<T>(z);
+            return r;
+            }
+        return {first, std::errc::invalid_argument};
+        }
+    static std::to_chars_result to_chars(char* first, char* last, T t)
+        {return std::to_chars(first, last, static_cast<int>(t));}
     static T strtoT(char const* nptr, char** endptr)
         {return bourn_cast<T>(std::strtol(nptr, endptr, 10));}
 };
@@ -211,7 +241,6 @@ template<> struct numeric_conversion_traits<int>
     :public numeric_conversion_traits<Integral>
 {
     typedef int T;
-    static char const* fmt() {return "%.*i";}
     static T strtoT(char const* nptr, char** endptr)
         {return static_cast<T>(std::strtol(nptr, endptr, 10));}
 };
@@ -220,7 +249,6 @@ template<> struct numeric_conversion_traits<short int>
     :public numeric_conversion_traits<Integral>
 {
     typedef short int T;
-    static char const* fmt() {return "%.*hi";}
     static T strtoT(char const* nptr, char** endptr)
         {return static_cast<T>(std::strtol(nptr, endptr, 10));}
 };
@@ -229,7 +257,6 @@ template<> struct numeric_conversion_traits<long int>
     :public numeric_conversion_traits<Integral>
 {
     typedef long int T;
-    static char const* fmt() {return "%.*li";}
     static T strtoT(char const* nptr, char** endptr)
         {return std::strtol(nptr, endptr, 10);}
 };
@@ -238,7 +265,6 @@ template<> struct numeric_conversion_traits<long long int>
     :public numeric_conversion_traits<Integral>
 {
     typedef long long int T;
-    static char const* fmt() {return "%.*lli";}
     static T strtoT(char const* nptr, char** endptr)
         {return std::strtoll(nptr, endptr, 10);}
 };
@@ -247,7 +273,6 @@ template<> struct numeric_conversion_traits<unsigned int>
     :public numeric_conversion_traits<Integral>
 {
     typedef unsigned int T;
-    static char const* fmt() {return "%.*u";}
     static T strtoT(char const* nptr, char** endptr)
         {return static_cast<T>(std::strtoul(nptr, endptr, 10));}
 };
@@ -256,7 +281,6 @@ template<> struct numeric_conversion_traits<unsigned short int>
     :public numeric_conversion_traits<Integral>
 {
     typedef unsigned short int T;
-    static char const* fmt() {return "%.*hu";}
     static T strtoT(char const* nptr, char** endptr)
         {return static_cast<T>(std::strtoul(nptr, endptr, 10));}
 };
@@ -265,7 +289,6 @@ template<> struct numeric_conversion_traits<unsigned long int>
     :public numeric_conversion_traits<Integral>
 {
     typedef unsigned long int T;
-    static char const* fmt() {return "%.*lu";}
     static T strtoT(char const* nptr, char** endptr)
         {return std::strtoul(nptr, endptr, 10);}
 };
@@ -274,7 +297,6 @@ template<> struct numeric_conversion_traits<unsigned long long int>
     :public numeric_conversion_traits<Integral>
 {
     typedef unsigned long long int T;
-    static char const* fmt() {return "%.*llu";}
     static T strtoT(char const* nptr, char** endptr)
         {return std::strtoull(nptr, endptr, 10);}
 };
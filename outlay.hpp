@@ -42,6 +42,7 @@ class modal_outlay final
         ,round_to<double> const& round_withdrawal
         ,round_to<double> const& round_loan
         );
+    modal_outlay(modal_outlay const&) = default;
     ~modal_outlay() = default;
 
     double                          dumpin               () const;
@@ -55,7 +56,6 @@ class modal_outlay final
     std::vector<double>      const& new_cash_loans       () const;
 
   private:
-    modal_outlay(modal_outlay const&) = delete;
     modal_outlay& operator=(modal_outlay const&) = delete;
 
     // Not yet used, but needed for MEC avoidance.
@@ -26,6 +26,7 @@
 #include "alert.hpp"
 #include "assert_lmi.hpp"
 #include "bourn_cast.hpp"
+#include "cache_file_reads.hpp"
 #include "data_directory.hpp"           // AddDataDir()
 #include "force_linking.hpp"
 #include "html.hpp"
@@ -44,6 +45,8 @@
 #include "ssize_lmi.hpp"
 #include "wx_table_generator.hpp"
 
+#include <boost/filesystem/operations.hpp> // exists()
+
 #include <wx/pdfdc.h>
 
 #include <wx/utils.h>                   // wxBusyCursor
@@ -57,12 +60,11 @@
 #include <exception>                    // uncaught_exceptions()
 #include <fstream>
 #include <map>
-#include <memory>                       // make_unique(), unique_ptr
-#include <regex>
+#include <memory>                       // make_unique(), shared_ptr, unique_ptr
 #include <sstream>
 #include <stdexcept>
 #include <string>
-#include <utility>                      // forward(), move()
+#include <utility>                      // forward(), move(), pair
 #include <vector>
 
 LMI_FORCE_LINKING_IN_SITU(pdf_command_wx)
@@ -103,6 +105,56 @@ std::string ir_suffix(interest_rate zero_or_not)
     throw "Unreachable--unknown interest_rate value";
 }
 
+// Return the path of the file containing the named partial template.
+std::string partial_template_path(std::string const& name)
+{
+    std::string const path = AddDataDir(name + ".xst");
+    if(!fs::exists(path))
+        {
+        alarum()
+            << "Template file \""
+            << name
+            << ".xst\" not found."
+            << std::flush
+            ;
+        }
+    return path;
+}
+
+// Return the de-obfuscated contents of a partial template file.
+std::string read_partial_template(std::string const& path)
+{
+    std::ifstream ifs(path);
+    if(!ifs)
+        {
+        alarum() << "Unable to read template file '" << path << "'." << std::flush;
+        }
+    std::string partial;
+    istream_to_string(ifs, partial);
+    for(auto& i : partial) i = static_cast<unsigned char>(i ^ 0xff);
+    return partial;
+}
+
+// A partial template file, compiled.
+//
+// Retrieved through file_cache, so that each file is read and
+// compiled only once, but read again if it has been changed since,
+// e.g. by someone editing templates during a session.
+class partial_template_file final
+    :public cache_file_reads<partial_template_file>
+{
+  public:
+    explicit partial_template_file(std::string const& path)
+        :compiled_ {read_partial_template(path).c_str()}
+    {
+    }
+
+    interpolation_template const& compiled() const {return compiled_;}
+
+  private:
+    interpolation_template const compiled_;
+};
+
 // Helper class grouping functions for dealing with interpolating strings
 // containing variable references.
 class html_interpolator
@@ -136,16 +188,53 @@ class html_interpolator
         throw std::runtime_error("invalid lookup kind");
     }
 
+    // Replace the "¶", "«" and "»" markers with the HTML tags for which
+    // they stand, and remove empty paragraphs, in a single pass.
+    //
+    // An empty paragraph is a "<p>" tag and a "</p>" tag, in either case
+    // and with optional blanks inside the tags, separated by nothing but
+    // whitespace. Because no marker can occur
+    // within an empty paragraph, and no replacement tag can form part
+    // of one, the order of these operations doesn't matter.
     static std::string reprocess(std::string const& raw_text)
     {
-        std::string z = raw_text;
+        static std::pair<std::string,std::string> const markers[] =
+            {{"¶", "<br>"}
+            ,{"«", "<strong>"}
+            ,{"»", "</strong>"}
+            };
 
-        z = std::regex_replace(z, std::regex("¶"), "<br>");
-        z = std::regex_replace(z, std::regex("«"), "<strong>");
-        z = std::regex_replace(z, std::regex("»"), "</strong>");
+        std::string z;
+        z.reserve(raw_text.size());
+        for(std::string::size_type i = 0; i < raw_text.size();)
+            {
+            if('<' == raw_text[i])
+                {
+                auto const n = empty_paragraph_length(raw_text, i);
+                if(0 != n)
+                    {
+                    i += n;
+                    continue;
+                    }
+                }
 
-        std::regex const empty_paragraph("< *[Pp] *>[[:space:]]*< */[Pp] *>");
-        z = std::regex_replace(z, empty_paragraph, "");
+            bool replaced = false;
+            for(auto const& m : markers)
+                {
+                if(0 == raw_text.compare(i, m.first.size(), m.first))
+                    {
+                    z += m.second;
+                    i += m.first.size();
+                    replaced = true;
+                    break;
+                    }
+                }
+            if(!replaced)
+                {
+                z += raw_text[i];
+                ++i;
+                }
+            }
 
         return z;
     }
@@ -163,37 +252,40 @@ class html_interpolator
     // variables explicitly defined by add_variable() calls.
     html::text operator()(char const* s) const
     {
-        std::string z =
-            interpolate_string
-                (s
-                ,[this]
-                    (std::string const& str
-                    ,interpolate_lookup_kind kind
-                    )
-                    {
-                        return interpolation_func(str, kind);
-                    }
+        return interpolate(interpolation_template(s));
+    }
+
+    html::text operator()(std::string const& s) const
+    {
+        return (*this)(s.c_str());
+    }
+
+    // Interpolate an already-compiled template: see operator()().
+    html::text interpolate(interpolation_template const& t) const
+    {
+        auto const lookup =
+            [this]
+                (std::string const& str
+                ,interpolate_lookup_kind kind
                 )
+                {
+                    return interpolation_func(str, kind);
+                }
             ;
+        std::string const z = interpolate_string
+            (t
+            ,lookup
+            ,compiled_partial
+            );
         return html::text::from_html
             (interpolate_string
-                (reprocess(z).c_str()
-                ,[this]
-                    (std::string const& str
-                    ,interpolate_lookup_kind kind
-                    )
-                    {
-                        return interpolation_func(str, kind);
-                    }
+                (interpolation_template(reprocess(z).c_str())
+                ,lookup
+                ,compiled_partial
                 )
             );
     }
 
-    html::text operator()(std::string const& s) const
-    {
-        return (*this)(s.c_str());
-    }
-
     // Add a variable, providing either its raw text or already escaped HTML
     // representation. Boolean values are converted to strings "0" or "1" as
     // expected.
@@ -253,10 +345,26 @@ class html_interpolator
     // Interpolate the contents of the given external template.
     //
     // This is exactly the same as interpolating "{{>template_name}}" string
-    // but a bit more convenient to use and simpler to read.
+    // but a bit more convenient to use and simpler to read. The partial
+    // itself is interpolated, so that string needn't be compiled.
     html::text expand_template(std::string const& template_name) const
     {
-        return (*this)("{{>" + template_name + "}}");
+        return interpolate(*compiled_partial(template_name));
+    }
+
+    // Return the compiled contents of the given partial template.
+    //
+    // Each template file is read, de-obfuscated and compiled only when
+    // it's first used and whenever it has changed since: see class
+    // partial_template_file.
+    static std::shared_ptr<interpolation_template const> compiled_partial
+        (std::string const& file
+        )
+    {
+        auto const z = partial_template_file::read_via_cache
+            (partial_template_path(file)
+            );
+        return {z, &z->compiled()};
     }
 
     // PDF !! Retrofitting this accessor seems to suggest that
@@ -313,22 +421,49 @@ class html_interpolator
         return html::text::from(evaluator_.value(s));
     }
 
-    std::string load_partial_from_file(std::string const& file) const
+    // Return the length of the empty paragraph starting at the given
+    // position, or zero if there is none. See reprocess().
+    static std::string::size_type empty_paragraph_length
+        (std::string const&     s
+        ,std::string::size_type pos
+        )
     {
-        std::ifstream ifs(AddDataDir(file + ".xst"));
-        if(!ifs)
+        auto i = pos;
+        auto const skip = [&s, &i](char const* chars)
             {
-            alarum()
-                << "Template file \""
-                << file
-                << ".xst\" not found."
-                << std::flush
-                ;
-            }
-        std::string partial;
-        istream_to_string(ifs, partial);
-        for(auto& i : partial) i = static_cast<unsigned char>(i ^ 0xff);
-        return partial;
+            while(i < s.size() && '\0' != s[i] && std::strchr(chars, s[i]))
+                {
+                ++i;
+                }
+            };
+        auto const accept = [&s, &i](char const* chars)
+            {
+            if(i < s.size() && '\0' != s[i] && std::strchr(chars, s[i]))
+                {
+                ++i;
+                return true;
+                }
+            return false;
+            };
+
+        if(!accept("<"))         return 0;
+        skip(" ");
+        if(!accept("Pp"))        return 0;
+        skip(" ");
+        if(!accept(">"))         return 0;
+        skip(" \t\n\v\f\r");
+        if(!accept("<"))         return 0;
+        skip(" ");
+        if(!accept("/"))         return 0;
+        if(!accept("Pp"))        return 0;
+        skip(" ");
+        if(!accept(">"))         return 0;
+        return i - pos;
+    }
+
+    static std::string load_partial_from_file(std::string const& file)
+    {
+        return read_partial_template(partial_template_path(file));
     }
 
     // Object used for variables expansion.
@@ -678,6 +813,50 @@ class scaled_image_cell : public html_cell_for_pdf_output
     double const scale_factor_;
 };
 
+/// An image file, decoded.
+///
+/// Retrieved through file_cache, so that each file is read and decoded
+/// only once, but read again if it has been changed since. Copying a
+/// wxImage is cheap because its data are reference counted.
+
+class image_file final
+    :public cache_file_reads<image_file>
+{
+  public:
+    explicit image_file(std::string const& path)
+        :image_ {load_image(path.c_str())}
+    {
+    }
+
+    wxImage const& image() const {return image_;}
+
+  private:
+    wxImage const image_;
+};
+
+/// Decoded image for an "img" tag's "src" attribute.
+///
+/// Every illustration of a census shows the same few images, so they
+/// are shared through class image_file. The path is resolved as
+/// load_image() resolves it. A missing file isn't cached, so that its
+/// warning is given each time, as it would be without caching; a file
+/// that can't be decoded yields a blank image until it's replaced.
+
+wxImage shared_image(wxString const& src)
+{
+    std::string const name = src.ToStdString();
+    fs::path path(name);
+    if(!fs::exists(path))
+        {
+        path = AddDataDir(name);
+        }
+    if(!fs::exists(path))
+        {
+        return load_image(name.c_str());
+        }
+    return image_file::read_via_cache(path.string())->image();
+}
+
 // Note that defining this handler replaces the standard <img> tag handler
 // defined in wxHTML itself, which also handles <map> and <area> tags, but as
 // we don't use either of those and all our images are scaled, this is fine.
@@ -719,7 +898,7 @@ TAG_HANDLER_BEGIN(scaled_image, "IMG")
             scale_factor = 1.0 / inv_factor;
             }
 
-        wxImage image(load_image(src.c_str()));
+        wxImage image(shared_image(src));
         if(image.IsOk())
             {
             m_WParser->GetContainer()->InsertCell
@@ -1206,7 +1385,7 @@ class page_with_marginals : public logical_page
         auto const& z = interpolator_;
         return html::text::from_html
             (interpolate_string
-                (("{{>" + templ + "}}").c_str()
+                (*html_interpolator::compiled_partial(templ)
                 ,[page_number_str, z]
                     (std::string const& s
                     ,interpolate_lookup_kind kind
@@ -1219,6 +1398,7 @@ class page_with_marginals : public logical_page
 
                     return z.interpolation_func(s, kind);
                     }
+                ,html_interpolator::compiled_partial
                 )
             );
     }
@@ -97,6 +97,7 @@ class premium_tax final
         (mcenum_state              tax_state
         ,product_database   const& db
         );
+    premium_tax(premium_tax const&) = default;
     ~premium_tax() = default;
 
     void   start_new_year();
@@ -110,7 +111,6 @@ class premium_tax final
     bool   is_tiered              () const;
 
   private:
-    premium_tax(premium_tax const&) = delete;
     premium_tax& operator=(premium_tax const&) = delete;
 
     void test_consistency() const;
@@ -26,6 +26,7 @@
 #include "alert.hpp"
 #include "bourn_cast.hpp"
 #include "crc32.hpp"
+#include "mapped_file.hpp"
 #include "miscellany.hpp"               // ios_in_binary(), ios_out_trunc_binary()
 #include "path_utility.hpp"
 #include "value_cast.hpp"
@@ -2453,10 +2454,8 @@ class database_impl final
     fs::path const path_;
 
     // The open database file: we keep it open to read table data on demand
-    // from it.
-    //
-    // An alternative approach could be to just load everything into memory at
-    // once.
+    // from it. When the database is constructed from a path, this stream
+    // reads the memory-mapped file in place.
     //
     // Notice that this pointer may be null if we don't have any input file or
     // if we had it but closed it because we didn't need it any more after
@@ -2474,18 +2473,35 @@ database_impl::database_impl(fs::path const& path)
         return;
         }
 
+    // Both files are mapped into memory and read in place. The index
+    // is parsed and validated once, here; table data are parsed only
+    // when a table is first requested, so opening a database costs
+    // time proportional to the size of its index, not its data.
     fs::path const index_path = get_index_path(path);
-    fs::ifstream ifs(index_path, ios_in_binary());
-    if(!ifs) alarum() << "Unable to open '" << index_path << "'." << LMI_FLUSH;
-    read_index(ifs);
+    {
+    mapped_file_istream index_is(index_path);
+    read_index(index_is);
+    }
 
-    // Open the database file right now to ensure that we can do it, even if we
+    // Map the database file right now to ensure that we can do it, even if we
     // don't need it just yet. As it will be used soon anyhow, delaying opening
     // it wouldn't be a useful optimization.
     fs::path const data_path = get_data_path(path);
-    auto const pifs = std::make_shared<fs::ifstream>(data_path, ios_in_binary());
-    if(!*pifs) alarum() << "Unable to open '" << data_path << "'." << LMI_FLUSH;
-    data_is_ = pifs;
+    auto const data_is = std::make_shared<mapped_file_istream>(data_path);
+    for(auto const& i : index_)
+        {
+        if(data_is->size() <= i.offset_)
+            {
+            alarum()
+                << "database index is corrupt: "
+                << "offset " << i.offset_
+                << " of table " << i.number_
+                << " is beyond the end of '" << data_path << "'"
+                << std::flush
+                ;
+            }
+        }
+    data_is_ = data_is;
 }
 
 database_impl::database_impl
@@ -349,6 +349,59 @@ void test_save()
         }
 }
 
+/// Test reading a database through its memory mapping.
+///
+/// Unlike the tests above, this one doesn't require any installed
+/// database, so it also exercises a database with only a few tables.
+
+void test_mapped_database()
+{
+    test_file_eraser erase_ndx("eraseme2.ndx");
+    test_file_eraser erase_dat("eraseme2.dat");
+
+    std::string text2 {simple_table_text};
+    text2.replace(text2.find("number: 1"), 9, "number: 2");
+    table t1 = table::read_from_text(simple_table_text);
+    table t2 = table::read_from_text(text2);
+    // Tables can't be saved without names.
+    t1.name("First table");
+    t2.name("Second table");
+
+    database db;
+    db.append_table(t1);
+    db.append_table(t2);
+    db.save("eraseme2");
+
+    {
+    database mapped("eraseme2");
+    BOOST_TEST_EQUAL(2, mapped.tables_count());
+    BOOST_TEST(t2 == mapped.get_nth_table(1));
+    BOOST_TEST(t1 == mapped.find_table(table::Number(1)));
+
+    // Saving closes the mapping, so the files it was read from can
+    // be replaced.
+    mapped.save("eraseme2");
+    }
+
+    {
+    database reread("eraseme2");
+    BOOST_TEST_EQUAL(2, reread.tables_count());
+    BOOST_TEST(t1 == reread.get_nth_table(0));
+    BOOST_TEST(t2 == reread.get_nth_table(1));
+    }
+
+    // An offset beyond the end of the data is detected when the
+    // database is opened, not when the table is first read.
+    std::ofstream ofs("eraseme2.dat", ios_out_trunc_binary());
+    ofs << 'x';
+    ofs.close();
+    BOOST_TEST_THROW
+        (database("eraseme2")
+        ,std::runtime_error
+        ,lmi_test::what_regex("beyond the end of 'eraseme2\\.dat'")
+        );
+}
+
 void test_add_table()
 {
     table const t = table::read_from_text(simple_table_text);
@@ -484,6 +537,7 @@ int test_main(int, char*[])
     test_table_access_by_index();
     test_table_access_by_number();
     test_save();
+    test_mapped_database();
     test_to_from_text();
     test_from_text();
     test_add_table();
@@ -257,6 +257,38 @@ prepaginator::prepaginator
         }
 }
 
+/// Number of rows on each page of an ungrouped table.
+///
+/// The first page may have room for fewer rows than the others,
+/// e.g., because a letterhead precedes the table; it may even have
+/// room for none. Only the row count, and not the row contents, is
+/// needed, so a page layout can be determined before any rows are
+/// drawn.
+///
+/// Subsequent pages are paginated by treating a whole page as a single
+/// group of rows, which therefore has no blank-line separators.
+
+std::vector<int> rows_on_each_page
+    (int number_of_rows
+    ,int first_page_capacity
+    ,int rows_per_page
+    )
+{
+    LMI_ASSERT(0 <= number_of_rows);
+    LMI_ASSERT(0 <= first_page_capacity);
+    LMI_ASSERT(0 <  rows_per_page);
+
+    std::vector<int> z {std::min(number_of_rows, first_page_capacity)};
+    int const rows_after_first_page = number_of_rows - z.front();
+    if(0 < rows_after_first_page)
+        {
+        prepaginator const p(rows_after_first_page, rows_per_page, rows_per_page);
+        z.insert(z.end(), p.number_of_pages() - 1, p.lines_on_full_page());
+        z.push_back(p.lines_on_last_page());
+        }
+    return z;
+}
+
 int paginator::init
     (int number_of_rows
     ,int rows_per_group
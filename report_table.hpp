@@ -28,6 +28,7 @@
 #include "so_attributes.hpp"
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 /// Elasticity and clipping
@@ -103,6 +104,46 @@ LMI_SO std::vector<int> set_column_widths
     ,int                                   minimum_margin
     );
 
+/// Text widths, memoized by font and string.
+///
+/// Measuring text through a device context is slow, yet reports
+/// measure the same strings--column headers, masks, and common values
+/// such as "0"--again and again, for every cell of every census. A
+/// font is identified by any string that distinguishes how it
+/// measures text (e.g., a wxFont's description), so this class needn't
+/// depend on any GUI library. Because a census's distinct values are
+/// unbounded, each font's widths are discarded whenever their number
+/// reaches max_strings_per_font.
+
+class LMI_SO text_extent_cache
+{
+  public:
+    static int const max_strings_per_font = 1 << 16;
+
+    /// Width of 'text' in 'font', calling 'measure()' if unknown.
+
+    template<typename F>
+    int width(std::string const& font, std::string const& text, F measure)
+        {
+        std::unordered_map<std::string,int>& widths = widths_[font];
+        auto const i = widths.find(text);
+        if(widths.end() != i)
+            {
+            return i->second;
+            }
+        if(max_strings_per_font <= static_cast<int>(widths.size()))
+            {
+            widths.clear();
+            }
+        int const z = measure();
+        widths.emplace(text, z);
+        return z;
+        }
+
+  private:
+    std::unordered_map<std::string,std::unordered_map<std::string,int>> widths_;
+};
+
 /// Display table rows in groups separated by blank lines.
 ///
 /// Nomenclature:
@@ -173,6 +214,12 @@ class LMI_SO prepaginator
     int       number_of_pages_;
 };
 
+LMI_SO std::vector<int> rows_on_each_page
+    (int number_of_rows
+    ,int first_page_capacity
+    ,int rows_per_page
+    );
+
 class LMI_SO paginator
 {
   public:
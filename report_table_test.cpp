@@ -86,6 +86,8 @@ class report_table_test
         test_column_widths_for_group_quotes();
         test_column_widths_for_illustrations();
         test_paginator();
+        test_rows_on_each_page();
+        test_text_extent_cache();
         }
 
   private:
@@ -95,6 +97,8 @@ class report_table_test
     static void test_column_widths_for_group_quotes();
     static void test_column_widths_for_illustrations();
     static void test_paginator();
+    static void test_rows_on_each_page();
+    static void test_text_extent_cache();
 };
 
 void report_table_test::test_apportion()
@@ -643,6 +647,71 @@ void report_table_test::test_paginator()
     std::cout << test_pagination(9, 2, 7) << std::endl;
 }
 
+void report_table_test::test_rows_on_each_page()
+{
+    // Edge case: zero rows means one empty page.
+    BOOST_TEST(std::vector<int>({0}) == rows_on_each_page( 0, 5, 8));
+
+    // Everything fits on the first page, exactly or not.
+    BOOST_TEST(std::vector<int>({3}) == rows_on_each_page( 3, 5, 8));
+    BOOST_TEST(std::vector<int>({5}) == rows_on_each_page( 5, 5, 8));
+
+    // Subsequent pages may be full or partial.
+    BOOST_TEST(std::vector<int>({5, 1})    == rows_on_each_page( 6, 5, 8));
+    BOOST_TEST(std::vector<int>({5, 8})    == rows_on_each_page(13, 5, 8));
+    BOOST_TEST(std::vector<int>({5, 8, 1}) == rows_on_each_page(14, 5, 8));
+
+    // The first page may have no room for any row.
+    BOOST_TEST(std::vector<int>({0, 8, 2}) == rows_on_each_page(10, 0, 8));
+
+    // Pages after the first must have room for at least one row.
+    BOOST_TEST_THROW
+        (rows_on_each_page(1, 0, 0)
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Assertion.*failed")
+        );
+
+    // Negative number of data rows.
+    BOOST_TEST_THROW
+        (rows_on_each_page(-1, 5, 8)
+        ,std::runtime_error
+        ,lmi_test::what_regex("^Assertion.*failed")
+        );
+}
+
+void report_table_test::test_text_extent_cache()
+{
+    text_extent_cache cache;
+    int measured = 0;
+    auto measure = [&measured] (std::string const& s)
+        {
+        return [&measured, s] {++measured; return 7 * lmi::ssize(s);};
+        };
+
+    BOOST_TEST_EQUAL(21, cache.width("Helvetica 8", "999", measure("999")));
+    BOOST_TEST_EQUAL(21, cache.width("Helvetica 8", "999", measure("999")));
+    BOOST_TEST_EQUAL(1, measured);
+
+    // Different fonts and strings are measured separately.
+    BOOST_TEST_EQUAL(21, cache.width("Helvetica 9", "999", measure("999")));
+    BOOST_TEST_EQUAL(14, cache.width("Helvetica 8", "99" , measure("99" )));
+    BOOST_TEST_EQUAL(3, measured);
+
+    // A font's widths are forgotten when there get to be too many.
+    for(int j = 0; j < text_extent_cache::max_strings_per_font; ++j)
+        {
+        std::string const s = std::to_string(j);
+        cache.width("Courier 8", s, measure(s));
+        }
+    BOOST_TEST_EQUAL(3 + text_extent_cache::max_strings_per_font, measured);
+    cache.width("Courier 8", "x", measure("x"));
+    cache.width("Courier 8", "0", measure("0"));
+    BOOST_TEST_EQUAL(5 + text_extent_cache::max_strings_per_font, measured);
+    // Other fonts are unaffected.
+    cache.width("Helvetica 8", "999", measure("999"));
+    BOOST_TEST_EQUAL(5 + text_extent_cache::max_strings_per_font, measured);
+}
+
 int test_main(int, char*[])
 {
     report_table_test::test();
@@ -0,0 +1,183 @@
+// Run many input files through copies of one server.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#ifndef server_batch_hpp
+#define server_batch_hpp
+
+#include "config.hpp"
+
+#include "alert.hpp"
+#include "fenv_lmi.hpp"
+#include "ssize_lmi.hpp"
+
+#include <boost/filesystem/path.hpp>
+
+#include <algorithm>                    // max(), min(), replace()
+#include <atomic>
+#include <exception>
+#include <future>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/// Run many input files through copies of a server, writing a table.
+///
+/// Server is a copyable class like mec_server or gpt_server, whose
+/// operator() takes a file path and whose state() returns a
+/// MemberSymbolTable that summarizes the result. Files are run on
+/// 'n_threads' threads, each with its own copy of 'prototype', all in
+/// one process, so that product files and rate tables are read only
+/// once through the caches that retain them.
+///
+/// Writes to 'os' a tab-delimited table with a header row. Each row
+/// has the file path, every member of the server's state, and a
+/// diagnostic column. If a file fails, the state members are left
+/// empty and the diagnostic column holds the exception's what(),
+/// with tabs and newlines replaced by blanks. Then the next file is
+/// run. Only exceptions derived from std::exception are caught this
+/// way; any other is rethrown once every row before its file's has
+/// been written and every thread has been joined.
+///
+/// Rows are written in the order of 'file_paths', however many
+/// threads are used, and each is flushed as soon as it and all rows
+/// before it are ready, so that partial results are available if a
+/// long batch is interrupted.
+///
+/// Floating-point control words are thread-specific, so each thread
+/// sets its own. Alerts raised while running a file are shown on the
+/// thread that runs it.
+
+template<typename Server>
+void run_server_batch
+    (Server                   const& prototype
+    ,std::vector<fs::path>    const& file_paths
+    ,std::ostream&                   os
+    ,int                             n_threads
+    )
+{
+    using state_type = decltype(prototype.state());
+    std::vector<std::string> const names = state_type().member_names();
+
+    os << "file";
+    for(auto const& i : names)
+        {
+        os << '\t' << i;
+        }
+    os << "\tdiagnostic" << std::endl;
+
+    auto const row = [&names] (Server& server, fs::path const& file_path)
+        {
+        std::string diagnostic;
+        try
+            {
+            server(file_path);
+            }
+        catch(std::exception const& e)
+            {
+            diagnostic = e.what();
+            std::replace(diagnostic.begin(), diagnostic.end(), '\t', ' ');
+            std::replace(diagnostic.begin(), diagnostic.end(), '\n', ' ');
+            }
+
+        std::ostringstream oss;
+        oss << file_path.string();
+        state_type const state = server.state();
+        for(auto const& i : names)
+            {
+            oss << '\t';
+            if(diagnostic.empty())
+                {
+                oss << state[i].str();
+                }
+            }
+        oss << '\t' << diagnostic << '\n';
+        return oss.str();
+        };
+
+    int const n_files = lmi::ssize(file_paths);
+    n_threads = std::max(1, std::min(n_threads, n_files));
+    if(1 == n_threads)
+        {
+        Server server(prototype);
+        for(auto const& i : file_paths)
+            {
+            os << row(server, i) << std::flush;
+            }
+        }
+    else
+        {
+        std::vector<std::promise<std::string>> rows(file_paths.size());
+        std::atomic<int>  next_file {0};
+        std::atomic<bool> stopping  {false};
+        auto const work = [&] ()
+            {
+            fenv_initialize();
+            Server server(prototype);
+            for(int j = next_file++; j < n_files && !stopping; j = next_file++)
+                {
+                try
+                    {
+                    rows[j].set_value(row(server, file_paths[j]));
+                    }
+                catch(...)
+                    {
+                    rows[j].set_exception(std::current_exception());
+                    }
+                }
+            };
+        std::vector<std::future<void>> workers;
+        for(int j = 0; j < n_threads; ++j)
+            {
+            workers.push_back(std::async(std::launch::async, work));
+            }
+
+        std::exception_ptr e;
+        for(auto& i : rows)
+            {
+            try
+                {
+                os << i.get_future().get() << std::flush;
+                }
+            catch(...)
+                {
+                e = std::current_exception();
+                stopping = true;
+                break;
+                }
+            }
+        for(auto& i : workers)
+            {
+            i.get();
+            }
+        if(e)
+            {
+            std::rethrow_exception(e);
+            }
+        }
+
+    if(!os)
+        {
+        alarum() << "Unable to write batch results." << LMI_FLUSH;
+        }
+}
+
+#endif // server_batch_hpp
@@ -0,0 +1,208 @@
+// Run many input files through copies of one server--unit test.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+
+#include "pchfile.hpp"
+
+#include "server_batch.hpp"
+
+#include "any_member.hpp"
+#include "test_tools.hpp"
+
+#include <atomic>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>                       // this_thread::yield()
+#include <vector>
+
+class batch_state final
+    :public MemberSymbolTable<batch_state>
+{
+  public:
+    batch_state()
+        {
+        AscribeMembers();
+        }
+    batch_state(batch_state const& z)
+        :MemberSymbolTable<batch_state>()
+        {
+        AscribeMembers();
+        MemberSymbolTable<batch_state>::assign(z);
+        }
+    batch_state& operator=(batch_state const& z)
+        {
+        MemberSymbolTable<batch_state>::assign(z);
+        return *this;
+        }
+
+    int         B0_length {0};
+    std::string A0_name   {};
+
+  private:
+    void AscribeMembers()
+        {
+        ascribe("B0_length", &batch_state::B0_length);
+        ascribe("A0_name"  , &batch_state::A0_name  );
+        }
+};
+
+/// Server that fails for files whose stem is "bad" or "fatal".
+///
+/// A "fatal" file throws an exception not derived from std::exception,
+/// which must propagate. Every copy counts the files it runs in one
+/// shared total, so that the effect of stopping early can be seen.
+
+class batch_server
+{
+  public:
+    explicit batch_server(std::atomic<int>& n_run)
+        :n_run_ {n_run}
+        {}
+
+    bool operator()(fs::path const& file_path)
+        {
+        ++n_run_;
+        std::this_thread::yield();
+        std::string const stem = file_path.stem().string();
+        if("bad" == stem)
+            {
+            throw std::runtime_error("Cannot\trun\n'bad'.");
+            }
+        if("fatal" == stem)
+            {
+            throw "Fatal.";
+            }
+        state_.B0_length = lmi::ssize(stem);
+        state_.A0_name   = stem;
+        return true;
+        }
+
+    batch_state state() const {return state_;}
+
+  private:
+    std::atomic<int>& n_run_;
+    batch_state state_;
+};
+
+std::string const header("file\tA0_name\tB0_length\tdiagnostic\n");
+
+/// Columns are ordered as member_names() are: i.e., sorted. A failure
+/// leaves its row's state columns empty, and doesn't prevent
+/// subsequent files from being run. The prototype itself is never run.
+
+void test_serial()
+{
+    std::atomic<int> n_run {0};
+    batch_server const server(n_run);
+    std::vector<fs::path> const file_paths {"a.mec", "bad.mec", "ccc.mec"};
+    std::ostringstream oss;
+    run_server_batch(server, file_paths, oss, 1);
+    BOOST_TEST_EQUAL
+        (oss.str()
+        ,header +
+         "a.mec\ta\t1\t\n"
+         "bad.mec\t\t\tCannot run 'bad'.\n"
+         "ccc.mec\tccc\t3\t\n"
+        );
+    BOOST_TEST_EQUAL(3, n_run);
+    BOOST_TEST_EQUAL("", server.state().A0_name);
+
+    // An empty batch writes only the header, however many threads
+    // are requested.
+    for(int n_threads : {0, 1, 4})
+        {
+        std::ostringstream empty;
+        run_server_batch(server, std::vector<fs::path>(), empty, n_threads);
+        BOOST_TEST_EQUAL(header, empty.str());
+        }
+}
+
+/// Rows are written in the order of 'file_paths', so the table is
+/// identical for any number of threads.
+
+void test_concurrency()
+{
+    std::vector<fs::path> file_paths;
+    for(int j = 0; j < 500; ++j)
+        {
+        std::string const stem = 0 == j % 7 ? "bad" : std::string(1 + j % 13, 'x');
+        file_paths.push_back(stem + ".gpt");
+        }
+
+    std::atomic<int> n_run {0};
+    batch_server const server(n_run);
+    std::ostringstream serial;
+    run_server_batch(server, file_paths, serial, 1);
+    for(int n_threads : {2, 3, 8, 1000})
+        {
+        std::ostringstream concurrent;
+        run_server_batch(server, file_paths, concurrent, n_threads);
+        BOOST_TEST_EQUAL(serial.str(), concurrent.str());
+        }
+    BOOST_TEST_EQUAL(5 * lmi::ssize(file_paths), n_run);
+}
+
+/// An exception not derived from std::exception is rethrown only after
+/// every earlier row has been written, and no row after its file's is
+/// written. Remaining files aren't all run.
+
+void test_fatal_exception()
+{
+    std::vector<fs::path> file_paths {"a.mec", "bad.mec", "fatal.mec"};
+    for(int j = 0; j < 1000; ++j)
+        {
+        file_paths.push_back("z.mec");
+        }
+    std::string const expected =
+          header
+        + "a.mec\ta\t1\t\n"
+          "bad.mec\t\t\tCannot run 'bad'.\n"
+        ;
+
+    for(int n_threads : {1, 4})
+        {
+        std::atomic<int> n_run {0};
+        batch_server const server(n_run);
+        std::ostringstream oss;
+        bool caught = false;
+        try
+            {
+            run_server_batch(server, file_paths, oss, n_threads);
+            }
+        catch(char const*)
+            {
+            caught = true;
+            }
+        BOOST_TEST(caught);
+        BOOST_TEST_EQUAL(expected, oss.str());
+        BOOST_TEST(n_run < lmi::ssize(file_paths));
+        }
+}
+
+int test_main(int, char*[])
+{
+    test_serial();
+    test_concurrency();
+    test_fatal_exception();
+
+    return EXIT_SUCCESS;
+}
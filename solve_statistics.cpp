@@ -0,0 +1,164 @@
+// Statistics for iterative illustration solves.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#include "pchfile.hpp"
+
+#include "solve_statistics.hpp"
+
+#include "alert.hpp"
+#include "handle_exceptions.hpp"        // report_exception()
+#include "mc_enum_types_aux.hpp"        // mc_str()
+#include "timer.hpp"
+
+#include <algorithm>                    // max()
+#include <cfloat>                       // DECIMAL_DIG
+#include <map>
+#include <ostream>
+#include <utility>                      // make_pair()
+
+solve_statistics& solve_statistics::instance()
+{
+    try
+        {
+        static solve_statistics z;
+        return z;
+        }
+    catch(...)
+        {
+        report_exception();
+        alarum() << "Instantiation failed." << LMI_FLUSH;
+        throw "Unreachable--silences a compiler diagnostic.";
+        }
+}
+
+void solve_statistics::clear()
+{
+    records_.clear();
+}
+
+void solve_statistics::record(solve_record const& z)
+{
+    records_.push_back(z);
+}
+
+std::vector<solve_record> const& solve_statistics::records() const
+{
+    return records_;
+}
+
+/// Write totals, overall and by product and solve type.
+///
+/// The format resembles illustrator's timing display, to which it
+/// is appended. Nothing is written if no solve was performed.
+
+void solve_statistics::write_summary(std::ostream& os) const
+{
+    if(records_.empty())
+        {
+        return;
+        }
+
+    struct totals
+    {
+        int    solves             {0};
+        int    evaluations        {0};
+        int    bisection_steps    {0};
+        double seconds_evaluating {0.0};
+        double slowest_evaluation {0.0};
+    };
+
+    totals overall;
+    std::map<std::pair<std::string,std::string>,totals> by_key;
+    for(auto const& i : records_)
+        {
+        auto const key = std::make_pair(i.product_name, mc_str(i.solve_type));
+        for(totals* t : {&overall, &by_key[key]})
+            {
+            ++t->solves;
+            t->evaluations        += i.root.evaluations;
+            t->bisection_steps    += i.root.bisection_steps;
+            t->seconds_evaluating += i.seconds_evaluating;
+            t->slowest_evaluation  = std::max
+                (t->slowest_evaluation
+                ,i.slowest_evaluation
+                );
+            }
+        }
+
+    os
+        << "\n    Solves:       "
+        << overall.solves << " solves, "
+        << overall.evaluations << " evaluations, "
+        << Timer::elapsed_msec_str(overall.seconds_evaluating)
+        ;
+    for(auto const& i : by_key)
+        {
+        totals const& t = i.second;
+        os
+            << "\n      " << i.first.first << ' ' << i.first.second << ": "
+            << t.solves << " solves, "
+            << t.evaluations << " evaluations ("
+            << t.bisection_steps << " bisection steps), "
+            << Timer::elapsed_msec_str(t.seconds_evaluating)
+            << "; slowest evaluation "
+            << Timer::elapsed_msec_str(t.slowest_evaluation)
+            ;
+        }
+    os << '\n';
+}
+
+/// Write one tab-delimited line per solve, preceded by a header.
+
+void solve_statistics::write_records(std::ostream& os) const
+{
+    os
+        << "ProductName"
+        << "\tSolveType"
+        << "\tEvaluations"
+        << "\tExtrapolationSteps"
+        << "\tBisectionSteps"
+        << "\tInterpolationSteps"
+        << "\tInitialBracketWidth"
+        << "\tFinalBracketWidth"
+        << "\tFinalValue"
+        << "\tSecondsEvaluating"
+        << "\tSlowestEvaluation"
+        << '\n'
+        ;
+    os.precision(DECIMAL_DIG);
+    for(auto const& i : records_)
+        {
+        os
+            <<        i.product_name
+            << '\t' << mc_str(i.solve_type)
+            << '\t' << i.root.evaluations
+            << '\t' << i.root.extrapolation_steps
+            << '\t' << i.root.bisection_steps
+            << '\t' << i.root.interpolation_steps
+            << '\t' << i.root.initial_bracket_width
+            << '\t' << i.root.final_bracket_width
+            << '\t' << i.root.final_value
+            << '\t' << i.seconds_evaluating
+            << '\t' << i.slowest_evaluation
+            << '\n'
+            ;
+        }
+}
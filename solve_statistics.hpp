@@ -0,0 +1,80 @@
+// Statistics for iterative illustration solves.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#ifndef solve_statistics_hpp
+#define solve_statistics_hpp
+
+#include "config.hpp"
+
+#include "mc_enum_type_enums.hpp"
+#include "so_attributes.hpp"
+#include "zero.hpp"                     // root_statistics
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+/// Statistics for one iterative solve.
+///
+/// Evaluation times measure AccountValue::SolveTest() calls, which
+/// dominate the cost of a solve.
+
+struct solve_record
+{
+    std::string       product_name        {};
+    mcenum_solve_type solve_type          {mce_solve_none};
+    root_statistics   root                {};
+    double            seconds_evaluating  {0.0};
+    double            slowest_evaluation  {0.0};
+};
+
+/// Design notes for class solve_statistics.
+///
+/// Accumulates a solve_record for each solve performed since the
+/// last call to clear(), e.g., across all cells of a census, so that
+/// it can be seen which products and solve types dominate run time.
+///
+/// This is a simple Meyers singleton, with the expected threading and
+/// dead-reference issues.
+
+class LMI_SO solve_statistics final
+{
+  public:
+    static solve_statistics& instance();
+
+    void clear();
+    void record(solve_record const&);
+
+    std::vector<solve_record> const& records() const;
+
+    void write_summary(std::ostream&) const;
+    void write_records(std::ostream&) const;
+
+  private:
+    solve_statistics() = default;
+    ~solve_statistics() = default;
+    solve_statistics(solve_statistics const&) = delete;
+    solve_statistics& operator=(solve_statistics const&) = delete;
+
+    std::vector<solve_record> records_;
+};
+
+#endif // solve_statistics_hpp
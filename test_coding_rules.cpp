@@ -203,6 +203,7 @@ file::file(std::string const& file_path)
         : ".xsd"        == extension() ? e_xml_other
         : ".xsl"        == extension() ? e_xml_other
         // phyloanalyze() tests inspect only file name [sort by enumerator]
+        : phyloanalyze("^Benchmark_")  ? e_binary
         : phyloanalyze("^ChangeLog-")  ? e_binary
         : phyloanalyze("^Speed_")      ? e_binary
         : phyloanalyze("^tags$")       ? e_expungible
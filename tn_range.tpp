@@ -380,15 +380,20 @@ tn_range<Number,Trammel>::tn_range(std::string const& s)
 template<typename Number, typename Trammel>
 tn_range<Number,Trammel>& tn_range<Number,Trammel>::operator=(Number n)
 {
-    value_ = curb(n);
+    Number const z = curb(n);
+    bool const changed = !(z == value_);
+    value_ = z;
+    if(changed)
+        {
+        note_change();
+        }
     return *this;
 }
 
 template<typename Number, typename Trammel>
 tn_range<Number,Trammel>& tn_range<Number,Trammel>::operator=(std::string const& s)
 {
-    value_ = curb(value_cast<Number>(s));
-    return *this;
+    return operator=(value_cast<Number>(s));
 }
 
 /// Change minimum.
@@ -718,7 +723,7 @@ std::string tn_range<Number,Trammel>::diagnose_invalidity
 template<typename Number, typename Trammel>
 void tn_range<Number,Trammel>::enforce_circumscription()
 {
-    value_ = curb(value_);
+    operator=(value_);
 }
 
 template<typename Number, typename Trammel>
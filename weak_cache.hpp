@@ -0,0 +1,111 @@
+// Cache of instances shared by key and held weakly.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#ifndef weak_cache_hpp
+#define weak_cache_hpp
+
+#include "config.hpp"
+
+#include "assert_lmi.hpp"
+
+#include <algorithm>                    // max()
+#include <cstddef>                      // size_t
+#include <iterator>                     // next()
+#include <map>
+#include <memory>                       // shared_ptr, weak_ptr
+#include <mutex>
+
+/// Cache of class T instances shared among clients with equal keys.
+///
+/// Motivation: Certain objects are costly to construct, immutable
+/// once constructed, and identical for many cells of a census, so
+/// that one instance can serve all cells with the same key.
+///
+/// Entries are held weakly: an instance lasts only as long as some
+/// client refers to it. Thus, sharing occurs among clients that exist
+/// together (as in a census run month by month, which is where memory
+/// is at a premium), and no instance outlives the run that created
+/// it, so a later run reflects any intervening change to the files
+/// from which instances were constructed.
+///
+/// Requires: K is LessThanComparable, and must encompass everything
+/// that determines the value of a T instance; otherwise, a client
+/// could be handed an instance that differs from what it would have
+/// constructed itself.
+///
+/// Clients are expected to hold a single static instance. Retrieval
+/// is serialized, as for class file_cache, so that cells may be
+/// processed concurrently. The mutex is held while an instance is
+/// made, so that two live instances are never made for one key;
+/// therefore, 'make' must not retrieve anything from the same cache.
+
+template<typename K, typename T>
+class weak_cache final
+{
+  public:
+    weak_cache() = default;
+
+    /// Return an instance for the given key, calling 'make' to
+    /// construct one iff no live instance already exists.
+    ///
+    /// If 'make' throws, the cache is left as it was found, except
+    /// perhaps for an expired entry.
+
+    template<typename F>
+    std::shared_ptr<T> retrieve_or_make(K const& key, F make)
+        {
+        std::lock_guard<std::mutex> const lock(mutex_);
+
+        std::weak_ptr<T>& entry = cache_[key];
+        std::shared_ptr<T> z = entry.lock();
+        if(!z)
+            {
+            z = make();
+            entry = z;
+            }
+
+        // Expired entries are swept only when the map has doubled in
+        // size since the last sweep, so the amortized cost is constant.
+        if(sweep_threshold_ < cache_.size())
+            {
+            for(auto i = cache_.begin(); i != cache_.end();)
+                {
+                i = i->second.expired() ? cache_.erase(i) : std::next(i);
+                }
+            sweep_threshold_ = std::max(minimum_threshold, 2 * cache_.size());
+            }
+
+        LMI_ASSERT(z);
+        return z;
+        }
+
+  private:
+    weak_cache(weak_cache const&) = delete;
+    weak_cache& operator=(weak_cache const&) = delete;
+
+    static constexpr std::size_t minimum_threshold {64};
+
+    std::mutex mutex_;
+    std::map<K,std::weak_ptr<T>> cache_;
+    std::size_t sweep_threshold_ {minimum_threshold};
+};
+
+#endif // weak_cache_hpp
@@ -0,0 +1,126 @@
+// Cache of class T instances shared among clients with equal keys--unit test.
+//
+// Copyright (C) 2020 Gregory W. Chicares.
+//
+// This program is free software; you can redistribute it and/or modify
+// it under the terms of the GNU General Public License version 2 as
+// published by the Free Software Foundation.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program; if not, write to the Free Software Foundation,
+// Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301, USA
+//
+// https://savannah.nongnu.org/projects/lmi
+// email: <gchicares@sbcglobal.net>
+// snail: Chicares, 186 Belle Woods Drive, Glastonbury CT 06033, USA
+
+#include "pchfile.hpp"
+
+#include "weak_cache.hpp"
+
+#include "test_tools.hpp"
+
+#include <atomic>
+#include <future>
+#include <memory>                       // make_shared()
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+void test_sharing()
+{
+    weak_cache<int,std::string const> cache;
+    int made = 0;
+    auto make = [&made] {++made; return std::make_shared<std::string const>("x");};
+
+    auto a = cache.retrieve_or_make(1, make);
+    auto b = cache.retrieve_or_make(1, make);
+    auto c = cache.retrieve_or_make(2, make);
+    BOOST_TEST_EQUAL(2, made);
+    BOOST_TEST(a == b);
+    BOOST_TEST(a != c);
+
+    // An instance lasts only as long as some client refers to it.
+    a.reset();
+    b.reset();
+    auto d = cache.retrieve_or_make(1, make);
+    BOOST_TEST_EQUAL(3, made);
+    auto e = cache.retrieve_or_make(2, make);
+    BOOST_TEST_EQUAL(3, made);
+    BOOST_TEST(c == e);
+}
+
+void test_exception_safety()
+{
+    weak_cache<int,int> cache;
+    BOOST_TEST_THROW
+        (cache.retrieve_or_make(1, []() -> std::shared_ptr<int> {throw std::runtime_error("x");})
+        ,std::runtime_error
+        ,"x"
+        );
+    auto a = cache.retrieve_or_make(1, [] {return std::make_shared<int>(7);});
+    BOOST_TEST_EQUAL(7, *a);
+}
+
+/// Many threads retrieving a few keys get one instance per key.
+
+void test_concurrency()
+{
+    weak_cache<int,int const> cache;
+    std::atomic<int> made {0};
+    int const n_keys = 5;
+
+    std::vector<std::future<std::vector<std::shared_ptr<int const>>>> futures;
+    for(int t = 0; t < 8; ++t)
+        {
+        futures.push_back
+            (std::async
+                (std::launch::async
+                ,[&]
+                    {
+                    std::vector<std::shared_ptr<int const>> z;
+                    for(int j = 0; j < 1000; ++j)
+                        {
+                        int const k = j % n_keys;
+                        z.push_back
+                            (cache.retrieve_or_make
+                                (k
+                                ,[&made, k] {++made; return std::make_shared<int const>(k);}
+                                )
+                            );
+                        }
+                    return z;
+                    }
+                )
+            );
+        }
+
+    std::vector<std::vector<std::shared_ptr<int const>>> results;
+    for(auto& i : futures)
+        {
+        results.push_back(i.get());
+        }
+    BOOST_TEST_EQUAL(n_keys, made);
+    for(auto const& i : results)
+        {
+        for(int j = 0; j < n_keys; ++j)
+            {
+            BOOST_TEST(i[j] == results[0][j]);
+            BOOST_TEST_EQUAL(j, *i[j]);
+            }
+        }
+}
+
+int test_main(int, char*[])
+{
+    test_sharing();
+    test_exception_safety();
+    test_concurrency();
+
+    return EXIT_SUCCESS;
+}
@@ -29,6 +29,38 @@
 #include "ssize_lmi.hpp"
 
 #include <algorithm>                    // max()
+#include <map>
+#include <string>
+
+namespace
+{
+/// Text extents, shared by all tables: see text_extent_cache.
+
+text_extent_cache& extent_cache()
+{
+    static text_extent_cache z;
+    return z;
+}
+
+/// Key identifying how a DC measures text in its current font.
+
+std::string measurement_key(wxDC const& dc)
+{
+    return
+          std::to_string(dc.GetMapMode())
+        + ' '
+        + dc.GetFont().GetNativeFontInfoDesc().ToStdString()
+        ;
+}
+
+/// Columns laid out by lay_out_columns(), with their header height.
+
+struct column_layout
+{
+    std::vector<table_column_info> columns;
+    int                            max_header_lines;
+};
+} // Unnamed namespace.
 
 // Default size of various characters for illustrations and group quotes:
 //   'M' 7pt; 'N' 6pt; '1' 4pt; '9' 4pt; ',' 2pt
@@ -50,35 +82,12 @@ wx_table_generator::wx_table_generator
     ,char_height_      {dc_.GetCharHeight()}
     // Arbitrarily use 1.333 line spacing.
     ,row_height_       {(4 * char_height_ + 2) / 3}
-    ,one_em_           {dc_.GetTextExtent("M").x}
+    ,one_em_           {text_width("M")}
     ,max_header_lines_ {1}
     ,draw_separators_  {true}
     ,use_bold_headers_ {true}
 {
-    for(auto const& i : vc)
-        {
-        enroll_column(i);
-        }
-    // Ideally this would be '&thinsp;' instead of '&puncsp;'.
-    int const one_puncsp = dc_.GetTextExtent(".").x;
-    std::vector<int> const w = set_column_widths
-        (all_columns_
-        ,total_width_
-        ,2 * one_em_
-        ,one_puncsp
-        );
-
-    std::vector<table_column_info> resized_columns;
-    for(int j = 0; j < lmi::ssize(all_columns()); ++j)
-        {
-        resized_columns.emplace_back
-            (all_columns_[j].col_header()
-            ,w           [j]
-            ,all_columns_[j].alignment()
-            ,all_columns_[j].is_elastic() ? oe_elastic : oe_inelastic
-            );
-        }
-    all_columns_.swap(resized_columns);
+    lay_out_columns(vc);
 
     // Set a pen with zero width to make grid lines thin,
     // and round cap style so that they combine seamlessly.
@@ -101,35 +110,12 @@ wx_table_generator::wx_table_generator
     ,total_width_      {total_width}
     ,char_height_      {dc_.GetCharHeight()}
     ,row_height_       {char_height_}
-    ,one_em_           {dc_.GetTextExtent("M").x}
+    ,one_em_           {text_width("M")}
     ,max_header_lines_ {1}
     ,draw_separators_  {false}
     ,use_bold_headers_ {false}
 {
-    for(auto const& i : vc)
-        {
-        enroll_column(i);
-        }
-    // Ideally this would be '&thinsp;' instead of '&puncsp;'.
-    int const one_puncsp = dc_.GetTextExtent(".").x;
-    std::vector<int> const w = set_column_widths
-        (all_columns_
-        ,total_width_
-        ,2 * one_em_
-        ,one_puncsp
-        );
-
-    std::vector<table_column_info> resized_columns;
-    for(int j = 0; j < lmi::ssize(all_columns()); ++j)
-        {
-        resized_columns.emplace_back
-            (all_columns_[j].col_header()
-            ,w           [j]
-            ,all_columns_[j].alignment()
-            ,all_columns_[j].is_elastic() ? oe_elastic : oe_inelastic
-            );
-        }
-    all_columns_.swap(resized_columns);
+    lay_out_columns(vc);
 
     dc_.SetPen(illustration_rule_color);
 }
@@ -395,6 +381,79 @@ wxRect wx_table_generator::text_rect(int column, int y) const
     return z;
 }
 
+/// Enroll the given columns, then set their widths to fit the table.
+///
+/// Set all_columns_ and max_header_lines_.
+///
+/// A layout depends only on the style, the DC's font, the total width,
+/// and the column parameters, so it's computed once for each distinct
+/// combination, and then reused for every other table--e.g., for the
+/// same report page of each cell in a census.
+
+void wx_table_generator::lay_out_columns(std::vector<column_parameters> const& vc)
+{
+    static std::map<std::string,column_layout> layouts;
+
+    std::string key =
+          std::to_string(use_bold_headers_)
+        + '\n' + measurement_key(dc())
+        + '\n' + std::to_string(total_width_)
+        ;
+    for(auto const& i : vc)
+        {
+        key += '\n' + i.header + '\t' + i.widest_text;
+        key += '\t' + std::to_string(i.alignment);
+        key += '\t' + std::to_string(i.elasticity);
+        }
+
+    auto const found = layouts.find(key);
+    if(layouts.end() != found)
+        {
+        // Class table_column_info is not assignable, so copy and swap.
+        std::vector<table_column_info>(found->second.columns).swap(all_columns_);
+        max_header_lines_ = found->second.max_header_lines;
+        return;
+        }
+
+    for(auto const& i : vc)
+        {
+        enroll_column(i);
+        }
+    // Ideally this would be '&thinsp;' instead of '&puncsp;'.
+    int const one_puncsp = text_width(".");
+    std::vector<int> const w = set_column_widths
+        (all_columns_
+        ,total_width_
+        ,2 * one_em_
+        ,one_puncsp
+        );
+
+    std::vector<table_column_info> resized_columns;
+    for(int j = 0; j < lmi::ssize(all_columns()); ++j)
+        {
+        resized_columns.emplace_back
+            (all_columns_[j].col_header()
+            ,w           [j]
+            ,all_columns_[j].alignment()
+            ,all_columns_[j].is_elastic() ? oe_elastic : oe_inelastic
+            );
+        }
+    all_columns_.swap(resized_columns);
+
+    layouts.emplace(key, column_layout {all_columns_, max_header_lines_});
+}
+
+/// Width of 'text' in the DC's current font.
+
+int wx_table_generator::text_width(std::string const& text) const
+{
+    return extent_cache().width
+        (measurement_key(dc())
+        ,text
+        ,[this, &text] {return dc().GetTextExtent(text).x;}
+        );
+}
+
 /// Indicate an intention to include a column by storing its metadata.
 ///
 /// Sets max_header_lines_.
@@ -436,7 +495,7 @@ void wx_table_generator::enroll_column(column_parameters const& z)
         case oe_inelastic:
             {
             // Greater of header width and 'widest_text' width.
-            width = std::max(w, dc().GetTextExtent(z.widest_text).x);
+            width = std::max(w, text_width(z.widest_text));
             }
             break;
         case oe_elastic:
@@ -465,6 +524,17 @@ void wx_table_generator::do_output_single_row
         do_output_vert_separator(pos_x, y_top, pos_y);
         }
 
+    // Compute the key once per row, not once per cell.
+    std::string const font = measurement_key(dc());
+    auto width = [this, &font] (std::string const& s)
+        {
+        return extent_cache().width
+            (font
+            ,s
+            ,[this, &s] {return dc().GetTextExtent(s).x;}
+            );
+        };
+
     int const number_of_columns = lmi::ssize(all_columns());
     for(int i = 0; i < number_of_columns; ++i)
         {
@@ -483,12 +553,12 @@ void wx_table_generator::do_output_single_row
                     break;
                 case oe_center:
                     {
-                    x_text += (ci.col_width() - dc().GetTextExtent(s).x) / 2;
+                    x_text += (ci.col_width() - width(s)) / 2;
                     }
                     break;
                 case oe_right:
                     {
-                    x_text += ci.col_width() - dc().GetTextExtent(s).x;
+                    x_text += ci.col_width() - width(s);
                     }
                     break;
                 }
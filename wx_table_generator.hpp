@@ -125,8 +125,11 @@ class wx_table_generator
     wxRect external_text_rect(int a_column, int y) const;
 
   private:
+    void lay_out_columns(std::vector<column_parameters> const&);
     void enroll_column(column_parameters const&);
 
+    int text_width(std::string const&) const;
+
     void do_output_single_row
         (int&                            pos_x
         ,int&                            pos_y
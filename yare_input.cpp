@@ -23,11 +23,17 @@
 
 #include "yare_input.hpp"
 
+#include "fenv_lmi.hpp"
 #include "input.hpp"
 #include "input_sequence_aux.hpp"       // convert_vector_type()
 #include "miscellany.hpp"               // each_equal()
+#include "ssize_lmi.hpp"
 
+#include <algorithm>                    // max(), min(), mismatch()
+#include <future>
+#include <iterator>                     // back_inserter(), distance()
 #include <numeric>                      // accumulate()
+#include <thread>
 
 yare_input::yare_input(Input const& z)
 {
@@ -246,3 +252,154 @@ double premium_allocation_to_sepacct(yare_input const& yi)
         }
     return z;
 }
+
+namespace
+{
+/// Lower 'z' to the first index at which 'a' and 'b' differ.
+///
+/// Vectors of different lengths differ at index zero.
+
+template<typename T>
+void lower_to_mismatch
+    (std::vector<T> const& a
+    ,std::vector<T> const& b
+    ,int&                  z
+    )
+{
+    if(a.size() != b.size())
+        {
+        z = 0;
+        return;
+        }
+    auto const m = std::mismatch(a.begin(), a.end(), b.begin());
+    z = std::min(z, static_cast<int>(m.first - a.begin()));
+}
+} // Unnamed namespace.
+
+/// First duration at which any vector member differs.
+///
+/// Scalar members are not compared. Vectors that are not indexed by
+/// duration (fund allocations, and 7702A premium history) count as
+/// differing at duration zero. If no vector differs, the result is
+/// the number of durations.
+
+int first_differing_duration(yare_input const& a, yare_input const& b)
+{
+    int z = lmi::ssize(a.Payment);
+    if
+        (  a.FundAllocations                != b.FundAllocations
+        || a.Inforce7702AAmountsPaidHistory != b.Inforce7702AAmountsPaidHistory
+        )
+        {
+        z = 0;
+        }
+    lower_to_mismatch(a.ExtraMonthlyCustodialFee   , b.ExtraMonthlyCustodialFee   , z);
+    lower_to_mismatch(a.ExtraCompensationOnAssets  , b.ExtraCompensationOnAssets  , z);
+    lower_to_mismatch(a.ExtraCompensationOnPremium , b.ExtraCompensationOnPremium , z);
+    lower_to_mismatch(a.PartialMortalityMultiplier , b.PartialMortalityMultiplier , z);
+    lower_to_mismatch(a.CurrentCoiMultiplier       , b.CurrentCoiMultiplier       , z);
+    lower_to_mismatch(a.CorporationTaxBracket      , b.CorporationTaxBracket      , z);
+    lower_to_mismatch(a.TaxBracket                 , b.TaxBracket                 , z);
+    lower_to_mismatch(a.ProjectedSalary            , b.ProjectedSalary            , z);
+    lower_to_mismatch(a.SpecifiedAmount            , b.SpecifiedAmount            , z);
+    lower_to_mismatch(a.SupplementalAmount         , b.SupplementalAmount         , z);
+    lower_to_mismatch(a.DeathBenefitOption         , b.DeathBenefitOption         , z);
+    lower_to_mismatch(a.Payment                    , b.Payment                    , z);
+    lower_to_mismatch(a.PaymentMode                , b.PaymentMode                , z);
+    lower_to_mismatch(a.CorporationPayment         , b.CorporationPayment         , z);
+    lower_to_mismatch(a.CorporationPaymentMode     , b.CorporationPaymentMode     , z);
+    lower_to_mismatch(a.GeneralAccountRate         , b.GeneralAccountRate         , z);
+    lower_to_mismatch(a.SeparateAccountRate        , b.SeparateAccountRate        , z);
+    lower_to_mismatch(a.NewLoan                    , b.NewLoan                    , z);
+    lower_to_mismatch(a.Withdrawal                 , b.Withdrawal                 , z);
+    lower_to_mismatch(a.FlatExtra                  , b.FlatExtra                  , z);
+    lower_to_mismatch(a.HoneymoonValueSpread       , b.HoneymoonValueSpread       , z);
+    lower_to_mismatch(a.CashValueEnhancementRate   , b.CashValueEnhancementRate   , z);
+    lower_to_mismatch(a.SpecifiedAmountStrategy    , b.SpecifiedAmountStrategy    , z);
+    lower_to_mismatch(a.SupplementalAmountStrategy , b.SupplementalAmountStrategy , z);
+    lower_to_mismatch(a.PaymentStrategy            , b.PaymentStrategy            , z);
+    lower_to_mismatch(a.CorporationPaymentStrategy , b.CorporationPaymentStrategy , z);
+    return z;
+}
+
+namespace
+{
+std::vector<yare_input> yare_cells_in_range
+    (std::vector<Input>::const_iterator first
+    ,std::vector<Input>::const_iterator last
+    )
+{
+    std::vector<yare_input> z;
+    z.reserve(std::distance(first, last));
+    for(; first != last; ++first)
+        {
+        z.emplace_back(Input::consummate(*first));
+        }
+    return z;
+}
+} // Unnamed namespace.
+
+/// Census cells in the compact form that calculations use.
+///
+/// Each cell is consummated exactly as AccountValue's ctor would do
+/// (see Input::consummate()), so running the result is equivalent to
+/// running the original cells. A yare_input holds no UDTs, sequence
+/// strings, or symbol table, and no product_database; it's several
+/// times smaller than an Input, so a census runner that holds this
+/// form, instead of a std::vector<Input>, uses correspondingly less
+/// memory once the Input objects are destroyed. This function doesn't
+/// release them: the result is an addition to the memory they already
+/// occupy until the caller disposes of them.
+///
+/// Each cell passes through an Input, because consummation is
+/// implemented only by that class. With 'concurrently', cells are
+/// converted in contiguous chunks by as many threads as there are
+/// processors. Alerts raised in other threads must not reach a GUI,
+/// so that option is only for command-line programs.
+
+std::vector<yare_input> yare_cells
+    (std::vector<Input> const& cells
+    ,bool                      concurrently
+    )
+{
+    int const n_threads =
+        concurrently
+        ? std::min
+            (lmi::ssize(cells)
+            ,std::max(1, static_cast<int>(std::thread::hardware_concurrency()))
+            )
+        : 1
+        ;
+    if(n_threads <= 1)
+        {
+        return yare_cells_in_range(cells.begin(), cells.end());
+        }
+
+    // Floating-point control words are thread-specific, so each
+    // thread sets its own.
+    std::vector<std::future<std::vector<yare_input>>> chunks;
+    for(int j = 0; j < n_threads; ++j)
+        {
+        auto const first = cells.begin() + j       * lmi::ssize(cells) / n_threads;
+        auto const last  = cells.begin() + (1 + j) * lmi::ssize(cells) / n_threads;
+        chunks.push_back
+            (std::async
+                (std::launch::async
+                ,[first, last]()
+                    {
+                    fenv_initialize();
+                    return yare_cells_in_range(first, last);
+                    }
+                )
+            );
+        }
+
+    std::vector<yare_input> z;
+    z.reserve(cells.size());
+    for(auto& j : chunks)
+        {
+        std::vector<yare_input> chunk = j.get();
+        std::move(chunk.begin(), chunk.end(), std::back_inserter(z));
+        }
+    return z;
+}
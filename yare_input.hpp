@@ -26,6 +26,7 @@
 
 #include "calendar_date.hpp"
 #include "mc_enum_type_enums.hpp"
+#include "so_attributes.hpp"
 
 #include <string>
 #include <vector>
@@ -259,4 +260,11 @@ bool is_policy_rated(yare_input const&);
 
 double premium_allocation_to_sepacct(yare_input const&);
 
+int first_differing_duration(yare_input const&, yare_input const&);
+
+LMI_SO std::vector<yare_input> yare_cells
+    (std::vector<Input> const& cells
+    ,bool                      concurrently
+    );
+
 #endif // yare_input_hpp
@@ -27,12 +27,14 @@
 #include "null_stream.hpp"
 #include "round_to.hpp"
 
+#include <algorithm>                    // max(), min(), sort()
 #include <cfloat>                       // DECIMAL_DIG
 #include <cmath>
 #include <limits>
 #include <ostream>
 #include <string>
 #include <utility>
+#include <vector>
 
 enum root_validity
     {root_is_valid
@@ -47,6 +49,31 @@ enum root_bias
 
 typedef std::pair<double,root_validity> root_type;
 
+/// Statistics optionally gathered by decimal_root().
+///
+/// Evaluations include those at the a priori bounds, and any made
+/// only to guarantee side effects. Each pass through the main loop
+/// takes one step, either by bisection or by interpolation (linear
+/// or inverse quadratic); it is followed by an evaluation unless the
+/// rounded iterand has already been evaluated (see Note 4). Only
+/// secant_decimal_root() takes extrapolation steps.
+///
+/// The final bracket width is |c - b| when a root is returned: the
+/// interval known to contain the root, which the iterands' rounding
+/// may prevent from shrinking to zero. The final value is f at the
+/// root returned.
+
+struct root_statistics
+{
+    int    evaluations           {0};
+    int    extrapolation_steps   {0};
+    int    bisection_steps       {0};
+    int    interpolation_steps   {0};
+    double initial_bracket_width {0.0};
+    double final_bracket_width   {0.0};
+    double final_value           {0.0};
+};
+
 /// Return a zero z of a function f within input bounds [a,b].
 ///
 /// Precondition: either
@@ -229,20 +256,28 @@ typedef std::pair<double,root_validity> root_type;
 /// bound stays fixed to within rounding (for instance, at the edge of
 /// a discontinuity) often enough that it is worthwhile to avoid
 /// superfluous reevaluation.
+///
+/// If a root_statistics object is supplied, its prior contents are
+/// discarded, and statistics for this invocation are stored in it.
 
 template<typename FunctionalType>
 root_type decimal_root
-    (double          bound0
-    ,double          bound1
-    ,root_bias       bias
-    ,int             decimals
-    ,FunctionalType& f
-    ,bool            guarantee_side_effects = false
-    ,std::ostream&   iteration_stream       = null_stream()
+    (double           bound0
+    ,double           bound1
+    ,root_bias        bias
+    ,int              decimals
+    ,FunctionalType&  f
+    ,bool             guarantee_side_effects = false
+    ,std::ostream&    iteration_stream       = null_stream()
+    ,root_statistics* statistics             = nullptr
     )
 {
     iteration_stream.precision(DECIMAL_DIG);
 
+    root_statistics discarded_statistics;
+    root_statistics& stats = statistics ? *statistics : discarded_statistics;
+    stats = root_statistics();
+
     static double const epsilon = std::numeric_limits<double>::epsilon();
 
     int number_of_iterations = 0;
@@ -253,8 +288,10 @@ root_type decimal_root
 
     double a = round_(bound0);
     double b = round_(bound1);
+    stats.initial_bracket_width = std::fabs(b - a);
 
     double fa = static_cast<double>(f(a));
+    ++stats.evaluations;
     if(iteration_stream.good())
         {
         iteration_stream
@@ -270,6 +307,7 @@ root_type decimal_root
         }
 
     double fb = static_cast<double>(f(b));
+    ++stats.evaluations;
     if(iteration_stream.good())
         {
         iteration_stream
@@ -322,7 +360,10 @@ root_type decimal_root
                 if(guarantee_side_effects && last_evaluated_iterand != b)
                     {
                     f(b);
+                    ++stats.evaluations;
                     }
+                stats.final_bracket_width = std::fabs(c - b);
+                stats.final_value         = fb;
                 return std::make_pair(b, root_is_valid);
                 }
             else if(std::fabs(m) <= 2.0 * epsilon * std::fabs(c) + t)
@@ -330,7 +371,10 @@ root_type decimal_root
                 if(guarantee_side_effects && last_evaluated_iterand != c)
                     {
                     f(c);
+                    ++stats.evaluations;
                     }
+                stats.final_bracket_width = std::fabs(c - b);
+                stats.final_value         = fc;
                 return std::make_pair(c, root_is_valid);
                 }
             }
@@ -338,6 +382,7 @@ root_type decimal_root
             {
             // Bisection.
             d = e = m;
+            ++stats.bisection_steps;
             }
         else
             {
@@ -373,10 +418,12 @@ root_type decimal_root
                 )
                 {
                 d = p / q;
+                ++stats.interpolation_steps;
                 }
             else
                 {
                 d = e = m;
+                ++stats.bisection_steps;
                 }
             }
         a = b;
@@ -406,6 +453,7 @@ root_type decimal_root
         else
             {
             fb = static_cast<double>(f(b));
+            ++stats.evaluations;
             last_evaluated_iterand = b;
             if(iteration_stream.good())
                 {
@@ -420,6 +468,209 @@ root_type decimal_root
         }
 }
 
+namespace detail
+{
+/// Function adaptor that remembers every value it has calculated.
+///
+/// Evaluation is assumed to be costly, so a value is never
+/// calculated twice for the same argument.
+
+template<typename FunctionalType>
+class remembering_function
+{
+  public:
+    explicit remembering_function(FunctionalType& f)
+        :f_ {f}
+        {
+        }
+
+    double operator()(double x)
+        {
+        for(auto const& i : values_)
+            {
+            if(x == i.first)
+                {
+                return i.second;
+                }
+            }
+        double const y = static_cast<double>(f_(x));
+        values_.push_back(std::make_pair(x, y));
+        return y;
+        }
+
+    /// Narrow [a,b] to the narrowest interval known to contain a root.
+    ///
+    /// Return true iff any evaluated pair of adjacent iterands has
+    /// values of opposite sign, or any iterand has a value of zero.
+
+    bool narrow_bracket(double& a, double& b) const
+        {
+        std::vector<std::pair<double,double>> v(values_);
+        std::sort(v.begin(), v.end());
+        bool found = false;
+        for(int j = 0; j < static_cast<int>(v.size()); ++j)
+            {
+            if(0.0 == v[j].second)
+                {
+                a = b = v[j].first;
+                return true;
+                }
+            if
+                (  0 < j
+                && (0.0 < v[j - 1].second) != (0.0 < v[j].second)
+                && (!found || v[j].first - v[j - 1].first < b - a)
+                )
+                {
+                a = v[j - 1].first;
+                b = v[j].first;
+                found = true;
+                }
+            }
+        return found;
+        }
+
+    int evaluations() const {return static_cast<int>(values_.size());}
+
+    double last_evaluated_iterand() const {return values_.back().first;}
+
+  private:
+    FunctionalType& f_;
+    std::vector<std::pair<double,double>> values_;
+};
+} // namespace detail
+
+/// Return a zero z of a function f within input bounds [a,b],
+/// extrapolating along secants from two initial iterands.
+///
+/// Motivation: decimal_root() must begin by evaluating f at the
+/// a priori bounds, which are often far wider than necessary--e.g.,
+/// a billion dollars for a premium solve. Yet some functions (such as
+/// CSV at a target duration, as a function of premium) are nearly
+/// linear, so that a secant drawn through any two points lands close
+/// to the root.
+///
+/// Algorithm: Evaluate f at the two initial iterands. Then repeatedly
+/// extrapolate along the secant through the two latest iterands, to
+/// the point where it crosses zero. Each new iterand is confined to
+/// the a priori bounds and rounded to the given number of decimals;
+/// if rounding makes it equal the latest iterand, then the adjacent
+/// rounded value in the secant's direction is used instead. Stop
+/// extrapolating as soon as any two iterands bracket a root, or if
+/// the secant is horizontal or an iterand repeats, or after
+/// max_extrapolations steps. Then call decimal_root() to refine the
+/// narrowest bracket found, or the a priori bounds if none was found.
+/// No iterand is ever evaluated twice, so that handover costs no
+/// evaluations when a bracket has been found.
+///
+/// Because the final answer is found by decimal_root(), this function
+/// has the same postconditions, and respects bias in the same way.
+/// In the worst case, it costs max_extrapolations more evaluations;
+/// for a linear function, it finds a bracket after one extrapolation.
+/// However, it may find a different root than decimal_root() would
+/// if more than one root lies within the a priori bounds.
+///
+/// If side effects are to be guaranteed, f is reevaluated iff the
+/// last iterand evaluated is not the root returned.
+
+template<typename FunctionalType>
+root_type secant_decimal_root
+    (double           bound0
+    ,double           bound1
+    ,double           iterand0
+    ,double           iterand1
+    ,root_bias        bias
+    ,int              decimals
+    ,FunctionalType&  f
+    ,bool             guarantee_side_effects = false
+    ,std::ostream&    iteration_stream       = null_stream()
+    ,root_statistics* statistics             = nullptr
+    ,int              max_extrapolations     = 8
+    )
+{
+    iteration_stream.precision(DECIMAL_DIG);
+
+    round_to<double> const round_(decimals, r_to_nearest);
+
+    double const lower = round_(std::min(bound0, bound1));
+    double const upper = round_(std::max(bound0, bound1));
+
+    detail::remembering_function<FunctionalType> g(f);
+    int extrapolation_steps = 0;
+
+    double a = lower;
+    double b = upper;
+    double x0 = round_(std::min(upper, std::max(lower, iterand0)));
+    double x1 = round_(std::min(upper, std::max(lower, iterand1)));
+    if(x0 != x1)
+        {
+        double y0 = g(x0);
+        double y1 = g(x1);
+        while(!g.narrow_bracket(a, b) && extrapolation_steps < max_extrapolations)
+            {
+            if(y0 == y1)
+                {
+                break;
+                }
+            double x2 = x1 - y1 * (x1 - x0) / (y1 - y0);
+            double const direction = x2 - x1;
+            x2 = round_(std::min(upper, std::max(lower, x2)));
+            if(x2 == x1)
+                {
+                // The secant crosses zero within rounding of x1: step
+                // to the adjacent rounded value to bracket the root.
+                x2 = x1 + std::copysign(std::pow(10.0, -decimals), direction);
+                x2 = round_(std::min(upper, std::max(lower, x2)));
+                }
+            if(x2 == x0 || x2 == x1)
+                {
+                break;
+                }
+            ++extrapolation_steps;
+            x0 = x1;
+            y0 = y1;
+            x1 = x2;
+            y1 = g(x1);
+            if(iteration_stream.good())
+                {
+                iteration_stream
+                    << "extrapolation " << extrapolation_steps
+                    << " iterand "      << x1
+                    << " value "        << y1
+                    << std::endl
+                    ;
+                }
+            }
+        }
+
+    root_statistics discarded_statistics;
+    root_statistics& stats = statistics ? *statistics : discarded_statistics;
+    root_type const z = decimal_root
+        (a
+        ,b
+        ,bias
+        ,decimals
+        ,g
+        ,false
+        ,iteration_stream
+        ,&stats
+        );
+
+    stats.evaluations           = g.evaluations();
+    stats.extrapolation_steps   = extrapolation_steps;
+    stats.initial_bracket_width = upper - lower;
+
+    if
+        (   guarantee_side_effects
+        &&  root_is_valid == z.second
+        &&  g.last_evaluated_iterand() != z.first
+        )
+        {
+        f(z.first);
+        ++stats.evaluations;
+        }
+    return z;
+}
+
 /// A C++ equivalent of Brent's algol60 original, for reference only.
 
 template<typename FunctionalType>
@@ -82,6 +82,34 @@ struct e_functor
     double value;
 };
 
+struct e_counted
+{
+    double operator()(double z)
+        {
+        ++count;
+        return std::log(z) - 1.0;
+        }
+    int count {0};
+};
+
+/// A function that is piecewise linear, like CSV at a target duration
+/// as a function of premium: small premiums cause lapse, and large
+/// premiums are limited (e.g., by the guideline premium).
+
+struct e_kinked
+{
+    double operator()(double z)
+        {
+        ++count;
+        return
+              z <  1000.0 ? 0.5 * z - 5500.0
+            : z < 50000.0 ? 2.0 * z - 7000.125
+            :               92999.875
+            ;
+        }
+    int count {0};
+};
+
 struct e_nineteenth
 {
     double operator()(double z) {return std::pow(z, 19);}
@@ -149,6 +177,101 @@ int test_main(int, char*[])
     BOOST_TEST(std::exp(1.0) < r.first);
     BOOST_TEST(std::exp(1.0) < e.value);
 
+    // Test statistics.
+
+    e_counted ec;
+    root_statistics stats;
+    stats.bisection_steps = -1; // Must be overwritten.
+    r = decimal_root(0.5, 5.0, bias_lower, 9, ec, true, null_stream(), &stats);
+    BOOST_TEST(root_is_valid == r.second);
+    BOOST_TEST_EQUAL(ec.count, stats.evaluations);
+    BOOST_TEST(2 < stats.evaluations);
+    BOOST_TEST(0 <= stats.bisection_steps);
+    BOOST_TEST(0 < stats.interpolation_steps);
+    BOOST_TEST
+        (   stats.evaluations
+        <=  2 + 1 + stats.bisection_steps + stats.interpolation_steps
+        );
+    BOOST_TEST(materially_equal(4.5, stats.initial_bracket_width));
+    BOOST_TEST(0.0 < stats.final_bracket_width);
+    BOOST_TEST(stats.final_bracket_width <= 2.0e-9 + 6.0 * epsilon * 3.0);
+    BOOST_TEST(stats.final_value <= 0.0);
+    BOOST_TEST(std::fabs(stats.final_value) < 1.0e-9);
+    BOOST_TEST_EQUAL(stats.final_value, std::log(r.first) - 1.0);
+
+    // An interval containing no root takes two evaluations.
+
+    r = decimal_root(0.1, 1.0, bias_none, 9, e, false, null_stream(), &stats);
+    BOOST_TEST(root_not_bracketed == r.second);
+    BOOST_TEST_EQUAL(2, stats.evaluations);
+    BOOST_TEST_EQUAL(0, stats.bisection_steps);
+    BOOST_TEST_EQUAL(0, stats.interpolation_steps);
+
+    // Test extrapolation along secants.
+
+    // A linear function's root is bracketed immediately after one
+    // extrapolation and one step to the adjacent rounded value.
+    int linear_count = 0;
+    auto linear = [&linear_count] (double z) {++linear_count; return z - 1234567.891;};
+    r = secant_decimal_root
+        (0.0, 999999999.99, 0.0, 100000.0, bias_higher, 2, linear
+        ,false, null_stream(), &stats
+        );
+    BOOST_TEST(root_is_valid == r.second);
+    BOOST_TEST(materially_equal(1234567.90, r.first));
+    BOOST_TEST_EQUAL(4, linear_count);
+    BOOST_TEST_EQUAL(4, stats.evaluations);
+    BOOST_TEST_EQUAL(2, stats.extrapolation_steps);
+    BOOST_TEST(materially_equal(999999999.99, stats.initial_bracket_width));
+
+    // Kinks and plateaus cost a few more evaluations--but fewer than
+    // Brent's method needs, starting from distant bounds.
+    e_kinked ek;
+    r = secant_decimal_root
+        (0.0, 999999999.99, 0.0, 500.0, bias_lower, 2, ek
+        ,false, null_stream(), &stats
+        );
+    BOOST_TEST(root_is_valid == r.second);
+    BOOST_TEST(materially_equal(3500.06, r.first));
+    BOOST_TEST_EQUAL(ek.count, stats.evaluations);
+    BOOST_TEST(ek.count <= 8);
+    int const secant_count = ek.count;
+    BOOST_TEST(ek(r.first) <= 0.0);
+    ek.count = 0;
+    r = decimal_root(0.0, 999999999.99, bias_lower, 2, ek);
+    BOOST_TEST(materially_equal(3500.06, r.first));
+    BOOST_TEST(secant_count < ek.count);
+
+    // Bias is respected.
+    for(int dec = 1; dec <= 8; ++dec)
+        {
+        root_type sl = secant_decimal_root(0.5, 5.0, 1.0, 1.5, bias_lower , dec, e);
+        root_type sh = secant_decimal_root(0.5, 5.0, 1.0, 1.5, bias_higher, dec, e);
+        BOOST_TEST(root_is_valid == sl.second);
+        BOOST_TEST(root_is_valid == sh.second);
+        BOOST_TEST(sl.first <= std::exp(1.0));
+        BOOST_TEST(std::exp(1.0) <= sh.first);
+        BOOST_TEST(sh.first - sl.first <= std::pow(10.0, -dec) + 6.0 * epsilon * sh.first);
+        }
+
+    // Guaranteed side effects.
+    r = secant_decimal_root(0.5, 5.0, 1.0, 1.5, bias_lower, 9, e, true);
+    BOOST_TEST(r.first < std::exp(1.0));
+    BOOST_TEST_EQUAL(r.first, e.value);
+    r = secant_decimal_root(0.5, 5.0, 1.0, 1.5, bias_higher, 9, e, true);
+    BOOST_TEST(std::exp(1.0) < r.first);
+    BOOST_TEST_EQUAL(r.first, e.value);
+
+    // Identical initial iterands: just use Brent's method.
+    r = secant_decimal_root(0.5, 5.0, 1.0, 1.0, bias_none, 9, e, false, null_stream(), &stats);
+    BOOST_TEST(root_is_valid == r.second);
+    BOOST_TEST_EQUAL(0, stats.extrapolation_steps);
+
+    // No root within bounds, so extrapolation falls back to Brent's
+    // method, which reports failure.
+    r = secant_decimal_root(0.1, 1.0, 0.2, 0.3, bias_none, 9, e);
+    BOOST_TEST(root_not_bracketed == r.second);
+
     // Various tests--see macro definition.
 
     test_zero(0.5, 5.0, 1, e, std::exp(1.0));